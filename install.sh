@@ -30,6 +30,8 @@ $ch	-p or --pedantic      compile with '-pedantic' flag
 $ch	-l or --logging       enable logging (needed for verbosity level > 2)
 $ch	-s or --statistics    enable costly statistics (may impact runtime)
 $ch	-a or --all           enable all above flags except 'assert' and 'verbosity'
+$ch	-r or --compactref    use 32-bit clause references (CPU clause generations up to 4 GB each)
+$ch	-o or --hotvars       interleave variable level, reason and seen flag (CPU analysis layout)
 $ch	--clean=<target>      remove old installation of <cpu | gpu | all> solvers
 $ch	--standard=<n>        compile with <11 | 14 | 17 > c++ standard
 $ch	--extra="flags"       pass extra "flags" to the compiler(s)
@@ -61,6 +63,8 @@ logging=0
 pedantic=0
 standard=17
 statistics=0
+compactref=0
+hotvars=0
 
 while [ $# -gt 0 ]
 do
@@ -82,6 +86,8 @@ do
 	-g|--gpu) igpu=1;;
 
 	-a|--all) all=1;;
+	-r|--compactref) compactref=1;;
+	-o|--hotvars) hotvars=1;;
 
 	--clean=*)
 	  clean="${1#*=}"
@@ -277,6 +283,8 @@ if [[ "$HOST_OS" == *"cygwin"* ]]; then pedantic=0; fi
 [ $pedantic = 1 ] && CCFLAGS="$CCFLAGS -pedantic"
 [ $logging = 1 ] && CCFLAGS="$CCFLAGS -DLOGGING"
 [ $statistics = 1 ] && CCFLAGS="$CCFLAGS -DSTATISTICS"
+[ $compactref = 1 ] && CCFLAGS="$CCFLAGS -DCOMPACTREF"
+[ $hotvars = 1 ] && CCFLAGS="$CCFLAGS -DHOTVARS"
 
 CCFLAGS="$ARCH $STD$CCFLAGS"
 
@@ -50,10 +50,11 @@ uint32 ParaFROST::iadd()
 	const uint32 lit = V2L(v);
 	inf.nDualVars = lit + 2;
 	wt.expand(lit + 2);
-	ivalue.expand(lit + 2, UNDEFINED);
+	// 3 bytes of slack for the SIMD gathers in 'nonFalse' (see simd.h)
+	ivalue.expand(lit + 2 + 3, UNDEFINED);
 	bumps.expand(v + 1, 0);
 	activity.expand(v + 1, 0.0);
-	ilevel.expand(v + 1, UNDEFINED);
+	ilevel.expand(v + 1), ilevel[v] = UNDEFINED;
 	ifrozen.expand(v + 1, 0);
 	ivstate.expand(v + 1), ivstate[v] = VSTATE();
 	model.maxVar = v;
@@ -68,7 +69,7 @@ uint32 ParaFROST::iadd()
 			proof.init(sp);
 	}
 	sp->value = ivalue;
-	sp->level = ilevel;
+	sp->level = ilevel.data();
 	sp->vstate = ivstate;
 	return v;
 }
@@ -80,6 +81,7 @@ uint32 ParaFROST::iadd()
 
 bool ParaFROST::itoClause(Lits_t& c, Lits_t& org)
 {
+	if (proof.checking()) proof.checkOriginal(org);
 	if (org.empty()) {
 		learnEmpty();
 		PFLOG2(2, "  original clause is empty.");
@@ -87,6 +89,7 @@ bool ParaFROST::itoClause(Lits_t& c, Lits_t& org)
 	}
 	assert(c.empty());
 	assert(verifyMarkings(imarks, org));
+	if (model.image.enabled()) model.image.push(org);
 	bool satisfied = false;
 	if (verbose >= 3) printOriginal(org);
 	PFLOGN2(3, "  adding mapped clause  ( ");
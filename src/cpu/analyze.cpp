@@ -142,6 +142,7 @@ bool ParaFROST::chronoAnalyze()
 
 void ParaFROST::analyze()
 {
+	PERFPHASE(PERF_ANALYZE);
 	assert(conflict != NOREF);
 	assert(learntC.empty());
 	assert(analyzed.empty());
@@ -178,6 +179,7 @@ void ParaFROST::analyze()
 		bumpVariables();
 	}
 	else assert(learntC.size() == 1);
+	if (proof.lrat()) chainLearnt();
 	// backjump control
 	C_REF added = backjump();
 	// clear 
@@ -68,7 +68,6 @@ void ParaFROST::iunfreeze(const uint32& v)
 void ParaFROST::iassume(Lits_t& assumptions)
 {
 	assert(inf.maxVar);
-	assert(stats.clauses.original);
 	if (assumptions.empty()) return;
 	PFLOGN2(2, " Adding %d assumptions..", assumptions.size());
 	this->assumptions.reserve(assumptions.size());
@@ -90,7 +89,6 @@ void ParaFROST::iassume(Lits_t& assumptions)
 void ParaFROST::iunassume()
 {
 	assert(inf.maxVar);
-	assert(stats.clauses.original);
 	PFLOGN2(2, " Resetting %d assumptions and solver state..", assumptions.size());
 	if (assumptions.size()) {
 		forall_clause(assumptions, k) {
@@ -101,6 +99,7 @@ void ParaFROST::iunassume()
 		assumptions.clear(true);
 	}
 	cnfstate = UNSOLVED_M;
+	model.reset();
 	PFLDONE(2, 5);
 	backtrack();
 }
@@ -138,6 +137,27 @@ void ParaFROST::idecide()
 	stats.decisions.single++;
 }
 
+// a complete assignment is a model unless it falsifies an assumption
+void ParaFROST::isatisfied()
+{
+	assert(!inf.unassigned);
+	assert(sp->propagated == trail.size());
+	assert(conflict == NOREF);
+	assert(UNSOLVED(cnfstate));
+	forall_clause(assumptions, k) {
+		const uint32 a = *k;
+		CHECKLIT(a);
+		assert(ifrozen[ABS(a)]);
+		assert(!UNASSIGNED(sp->value[a]));
+		if (!sp->value[a]) {
+			ianalyze(FLIP(a));
+			cnfstate = UNSAT;
+			return;
+		}
+	}
+	cnfstate = SAT;
+}
+
 void ParaFROST::ianalyze(const uint32& failed)
 {
 	assert(cnfstate);
@@ -127,7 +127,7 @@ uint32 ParaFROST::autarkReasoning(LIT_ST* autarkies)
 			forall_clause(c, k) {
 				const uint32 lit = *k;
 				if (UNASSIGNED(values[lit]) && autarkies[lit] > 0) {
-					PFLOG2(4, "   adding c(%zd) to watch list(%d)", ref, l2i(lit));
+					PFLOG2(4, "   adding c(%zd) to watch list(%d)", size_t(ref), l2i(lit));
 					wt[FLIP(lit)].push(WATCH(ref, c.size(), lit));
 				}
 			}
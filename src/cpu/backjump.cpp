@@ -66,6 +66,7 @@ C_REF ParaFROST::backjump()
 	else {
 		if (opts.proof_en) proof.addClause(learntC);
 		C_REF r = newClause(learntC, true);
+		if (proof.lrat()) proof.bind(r);
 		enqueue(*learntC, jmplevel, r);
 		return r;
 	}
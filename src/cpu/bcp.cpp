@@ -19,11 +19,33 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "solve.h"
 using namespace pFROST;
 
+#if defined(_WIN32)
+#define PREFETCH(ADDR) PreFetchCacheLine(PF_TEMPORAL_LEVEL_1, (ADDR))
+#else
+#define PREFETCH(ADDR) __builtin_prefetch((ADDR), 0, 3)
+#endif
+
+// two-stage pipeline: fetch the blocking value of the watch '2 * dist' ahead,
+// then the header of a clause 'dist' ahead if its blocking literal is not true
+inline void ParaFROST::lookahead(const WATCH* i, const WATCH* wend, const LIT_ST* values, const int& dist)
+{
+	const int64 remaining = wend - i;
+	if (remaining > dist) {
+		const WATCH& near = i[dist];
+		if (!near.binary() && values[near.imp] <= 0)
+			PREFETCH(cm.address(near.ref));
+		if (remaining > (dist << 1))
+			PREFETCH(values + i[dist << 1].imp);
+	}
+}
+
 bool ParaFROST::BCP()
 {
+	PERFPHASE(PERF_BCP);
 	conflict = NOREF;
 	const uint32 propsbefore = sp->propagated;
 	LIT_ST* values = sp->value;
+	const int dist = opts.prefetch_dist;
 	bool isConflict = false;
 	while (!isConflict && sp->propagated < trail.size()) {
 		const uint32 assign = trail[sp->propagated++], f_assign = FLIP(assign);
@@ -34,6 +56,7 @@ bool ParaFROST::BCP()
 		uint64 ticks = cacheLines(ws.size(), sizeof(WATCH));
 		WATCH* i = ws, *j = i, * wend = ws.end();
 		while (i != wend) {
+			if (dist) lookahead(i, wend, values, dist);
 			const WATCH w = *j++ = *i++;
 			const uint32 imp = w.imp;
 			CHECKLIT(imp);
@@ -62,18 +85,24 @@ bool ParaFROST::BCP()
 					(j - 1)->imp = other; // satisfied, replace "w.imp" with new blocking "other"
 				else {
 					// === search for (un)-assigned-1 literal to watch
-					uint32* cmid = c.mid(), * cend = c.end();
-					uint32* k = cmid, newlit = 0;
-					LIT_ST _false_ = UNDEFINED;
-					while (k != cend && (_false_ = !values[newlit = *k])) k++;
-					assert(_false_ != UNDEFINED);
-					if (_false_) {
+					uint32* k, newlit;
+					if (c.size() == 3) { // ternary: the third literal is the only candidate
 						k = c + 2;
-						assert(c.pos() <= c.size());
-						while (k != cmid && (_false_ = !values[newlit = *k])) k++;
+						newlit = *k;
+					}
+					else {
+						uint32* cmid = c.mid(), * cend = c.end();
+						assert(cmid < cend);
+						k = nonFalse(cmid, cend, values);
+						if (k == cend) {
+							assert(c.pos() <= c.size());
+							k = nonFalse(c + 2, cmid, values);
+							newlit = (k == cmid) ? *(cend - 1) : *k; // all false: any scanned literal
+						}
+						else newlit = *k;
+						assert(k >= c + 2 && k <= c.end());
+						c.set_pos(int(k - c)); // set new position
 					}
-					assert(k >= c + 2 && k <= c.end());
-					c.set_pos(int(k - c)); // set new position
 					// ======== end of search ========
 					LIT_ST val = values[newlit];
 					if (val > 0) // found satisfied new literal (update "imp")
@@ -202,18 +231,24 @@ inline bool ParaFROST::proplarge(const uint32& assign, const bool& hyper)
 				(j - 1)->imp = other;
 			else {
 				// === search for (un)-assigned-1 literal to watch
-				uint32* cmid = c.mid(), * cend = c.end();
-				uint32* k = cmid, newlit = 0;
-				LIT_ST _false_ = UNDEFINED;
-				while (k != cend && (_false_ = !values[newlit = *k])) k++;
-				assert(_false_ != UNDEFINED);
-				if (_false_) {
+				uint32* k, newlit;
+				if (c.size() == 3) {
 					k = c + 2;
-					assert(c.pos() <= c.size());
-					while (k != cmid && (_false_ = !values[newlit = *k])) k++;
+					newlit = *k;
+				}
+				else {
+					uint32* cmid = c.mid(), * cend = c.end();
+					assert(cmid < cend);
+					k = nonFalse(cmid, cend, values);
+					if (k == cend) {
+						assert(c.pos() <= c.size());
+						k = nonFalse(c + 2, cmid, values);
+						newlit = (k == cmid) ? *(cend - 1) : *k; // all false: any scanned literal
+					}
+					else newlit = *k;
+					assert(k >= c + 2 && k <= c.end());
+					c.set_pos(int(k - c));
 				}
-				assert(k >= c + 2 && k <= c.end());
-				c.set_pos(int(k - c));
 				// ======== end of search ========
 				LIT_ST val = values[newlit];
 				if (val > 0)
@@ -236,7 +271,10 @@ inline bool ParaFROST::proplarge(const uint32& assign, const bool& hyper)
 							assert(learntC.empty());
 							learntC.push(dom);
 							learntC.push(other);
-							if (opts.proof_en) proof.addClause(learntC);
+							if (opts.proof_en) {
+								if (proof.lrat()) chainHyper(ref, dom, other);
+								proof.addClause(learntC);
+							}
 							const int csize = c.size();
 							newHyper2(); // 'c' after this line is not valid and cm[ref] should be used if needed
 							delayWatch(f_assign, other, ref, csize), j--;
@@ -23,7 +23,7 @@ inline uint32 ParaFROST::analyzeReason(const C_REF& ref, const uint32& lit)
 {
 	CHECKLIT(lit);
 	assert(REASON(ref));
-	int* levels = sp->level;
+	LEVELS levels = sp->level;
 	const uint32 fit = FLIP(lit);
 	CLAUSE& reason = cm[ref];
 	PFLCLAUSE(4, reason, "   checking %d reason", l2i(fit));
@@ -42,7 +42,7 @@ inline uint32 ParaFROST::analyzeReason(const C_REF& ref, const uint32& lit)
 uint32 ParaFROST::hyper2Resolve(CLAUSE& c, const uint32& lit)
 {
 	assert(DL() == 1);
-	int* levels = sp->level;
+	LEVELS levels = sp->level;
 	int nonRoots = 0;
 	uint32 child = 0;
 	forall_clause(c, k) {
@@ -160,7 +160,7 @@ inline void ParaFROST::xsubstitute(const uint32& x, Lits_t& out_c)
 				if (cj.original()) {
 					const bool b = cj.molten();
 					if (NEQUAL(a, b) && merge(x, ci, cj, out_c))
-						newResolvent(out_c);						
+						newResolvent(out_c, *i, *j);
 				}
 			}
 		}
@@ -181,18 +181,18 @@ inline void ParaFROST::xresolve(const uint32& x, Lits_t& out_c)
 			forall_occurs(other, j) {
 				SCLAUSE& cj = **j;
 				if (cj.original() && merge(x, ci, cj, out_c))
-					newResolvent(out_c);
+					newResolvent(out_c, *i, *j);
 			}
 		}
 	}
 }
 
-inline void ParaFROST::newResolvent(const Lits_t& resolvent)
+// 'resolvent' is the resolvent of the antecedents 'ci' and 'cj'
+inline void ParaFROST::newResolvent(const Lits_t& resolvent, const S_REF& ci, const S_REF& cj)
 {
 	const int size = resolvent.size();
 	assert(size);
-	const size_t bytes = hc_scsize + (size - 1) * hc_isize;
-	S_REF added = (S_REF) new Byte[bytes];
+	S_REF added = spool.alloc(size);
 	added->init(resolvent);
 	assert(added->size() == size);
 	assert(added->hasZero() < 0);
@@ -202,17 +202,21 @@ inline void ParaFROST::newResolvent(const Lits_t& resolvent)
 		const uint32 unit = **added;
 		const LIT_ST val = sp->value[unit];
 		if (UNASSIGNED(val)) {
+			if (proof.lrat()) proof.hintClause(ci), proof.hintClause(cj);
 			enqueueUnit(unit);
 		}
 		else if (!val) {
 			PFLOG2(2, "  BVE proved a contradiction");
+			if (proof.lrat()) proof.hintUnit(unit), proof.hintClause(ci), proof.hintClause(cj);
 			learnEmpty();
 			killSolver();
 		}
 	}
 	else {
-		if (opts.proof_en)
-			proof.addResolvent(*added);
+		if (opts.proof_en) {
+			if (proof.lrat()) proof.hintClause(ci), proof.hintClause(cj);
+			proof.addResolvent(added);
+		}
 		added->calcSig();
 		added->markAdded();
 		scnf.push(added);
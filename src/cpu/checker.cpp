@@ -0,0 +1,347 @@
+/***********************************************************************[checker.cpp]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#include "checker.h"
+
+using namespace pFROST;
+
+PROOFCHECKER::PROOFCHECKER() :
+	ring(NULL)
+	, head(0)
+	, tail(0)
+	, produced(0)
+	, freed(0)
+	, stopped(false)
+	, worker(NULL)
+	, nstalls(0)
+	, stalltime(0)
+	, garbage(0)
+	, noriginals(0)
+	, nlemmas(0)
+	, nrats(0)
+	, ndeleted(0)
+	, nmissing(0)
+	, failedat(0)
+	, propagated(0)
+	, inconsistent(false)
+	, refuted(false)
+	, failed(false)
+	{}
+
+void PROOFCHECKER::start()
+{
+	assert(worker == NULL);
+	ring = pfmalloc<uint32>(CHECK_QUEUE);
+	head = tail = produced = freed = 0;
+	stopped = false;
+	worker = new std::thread(&PROOFCHECKER::run, this);
+}
+
+void PROOFCHECKER::sync()
+{
+	if (worker == NULL) return;
+	while (head.load(std::memory_order_acquire) != produced)
+		std::this_thread::yield();
+}
+
+void PROOFCHECKER::stop()
+{
+	if (worker == NULL) return;
+	stopped.store(true, std::memory_order_release);
+	worker->join();
+	delete worker;
+	worker = NULL;
+	std::free(ring);
+	ring = NULL;
+	arena.clear(true);
+	table.clear();
+	for (uint32 i = 0; i < watches.size(); i++) watches[i].clear(true);
+	watches.clear(true);
+	values.clear(true), marks.clear(true), units.clear(true);
+	trail.clear(true), line.clear(true);
+	clause.clear(true), resolvent.clear(true);
+}
+
+void PROOFCHECKER::run()
+{
+	uint64 consumed = 0;
+	uint32 idle = 0;
+	while (true) {
+		const uint64 available = tail.load(std::memory_order_acquire);
+		if (consumed == available) {
+			if (stopped.load(std::memory_order_acquire)) break;
+			if (++idle < 64) std::this_thread::yield();
+			else std::this_thread::sleep_for(std::chrono::microseconds(100));
+			continue;
+		}
+		idle = 0;
+		while (consumed < available) {
+			const uint32 header = ring[consumed++ & (CHECK_QUEUE - 1)];
+			const uint32 size = header >> 2;
+			assert(consumed + size <= available);
+			line.clear();
+			for (uint32 i = 0; i < size; i++)
+				line.push(ring[consumed++ & (CHECK_QUEUE - 1)]);
+			process(header & 3, line, size);
+			head.store(consumed, std::memory_order_release);
+		}
+	}
+}
+
+void PROOFCHECKER::grow(const uint32& lit)
+{
+	const uint32 size = V2L(ABS(lit) + 1);
+	if (size <= values.size()) return;
+	values.expand(size, UNDEFINED);
+	marks.expand(size, UNDEFINED);
+	units.expand(size, 0);
+	watches.expand(size);
+}
+
+// removes duplicates of the line kept in 'resolvent'
+// and returns false if it is a tautology
+bool PROOFCHECKER::import(const uint32* lits, const uint32& size)
+{
+	resolvent.clear();
+	bool tautology = false;
+	for (uint32 i = 0; i < size; i++) {
+		const uint32 lit = lits[i];
+		assert(lit > 1);
+		grow(lit);
+		if (marks[lit] > 0) continue;
+		if (marks[FLIP(lit)] > 0) tautology = true;
+		marks[lit] = 1;
+		resolvent.push(lit);
+	}
+	for (uint32 i = 0; i < resolvent.size(); i++)
+		marks[resolvent[i]] = UNDEFINED;
+	return !tautology;
+}
+
+bool PROOFCHECKER::propagate()
+{
+	while (propagated < trail.size()) {
+		const uint32 flit = FLIP(trail[propagated++]);
+		CWL& ws = watches[flit];
+		CWATCH* i = ws, *j = i, *end = ws.end();
+		bool conflict = false;
+		while (i != end) {
+			const CWATCH w = *i++;
+			if (values[w.blocker] > 0) { *j++ = w; continue; }
+			uint32* c = arena + w.ref;
+			if (*c & CHECK_DELETED) continue;
+			const uint32 size = *c >> 1;
+			uint32* lits = c + 1;
+			if (lits[0] == flit) lits[0] = lits[1], lits[1] = flit;
+			assert(lits[1] == flit);
+			const uint32 other = lits[0];
+			if (values[other] > 0) { *j++ = CWATCH(w.ref, other); continue; }
+			uint32 k = 2;
+			while (k < size && !values[lits[k]]) k++;
+			if (k < size) {
+				lits[1] = lits[k], lits[k] = flit;
+				watches[lits[1]].push(CWATCH(w.ref, other));
+				continue;
+			}
+			*j++ = w;
+			if (!values[other]) {
+				conflict = true;
+				break;
+			}
+			assign(other);
+		}
+		while (i != end) *j++ = *i++;
+		ws.resize(uint32(j - ws.data()));
+		if (conflict) return false;
+	}
+	return true;
+}
+
+void PROOFCHECKER::backtrack(const uint32& level)
+{
+	while (trail.size() > level) {
+		const uint32 lit = trail.back();
+		values[lit] = values[FLIP(lit)] = UNDEFINED;
+		trail.pop();
+	}
+	propagated = level;
+}
+
+// reverse unit propagation on top of the root-level assignment
+bool PROOFCHECKER::rup(const uint32* lits, const uint32& size)
+{
+	if (inconsistent) return true;
+	assert(propagated == trail.size());
+	const uint32 level = trail.size();
+	bool implied = false;
+	for (uint32 i = 0; i < size && !implied; i++) {
+		const uint32 lit = lits[i];
+		const LIT_ST val = values[lit];
+		if (val > 0) implied = true;
+		else if (UNASSIGNED(val)) assign(FLIP(lit));
+	}
+	if (!implied) implied = !propagate();
+	backtrack(level);
+	return implied;
+}
+
+// resolution asymmetric tautology on the first literal of the lemma
+bool PROOFCHECKER::rat()
+{
+	if (clause.empty()) return false;
+	const uint32 pivot = clause[0], npivot = FLIP(pivot);
+	for (uint32 i = 0; i < clause.size(); i++) marks[clause[i]] = 1;
+	// units are kept only as assignments, so resolve on them first
+	bool redundant = !units[npivot] || rup(clause, clause.size());
+	uint64 ref = 0;
+	while (redundant && ref < arena.size()) {
+		const uint32* c = arena + ref;
+		const uint32 size = *c >> 1;
+		const uint32* lits = c + 1;
+		const bool deleted = *c & CHECK_DELETED;
+		ref += size + 1;
+		if (deleted) continue;
+		uint32 k = 0;
+		while (k < size && lits[k] != npivot) k++;
+		if (k == size) continue;
+		resolvent.clear();
+		bool tautology = false;
+		for (k = 0; k < size && !tautology; k++) {
+			const uint32 lit = lits[k];
+			if (lit == npivot) continue;
+			if (marks[FLIP(lit)] > 0) tautology = true;
+			else if (marks[lit] < 0) resolvent.push(lit);
+		}
+		if (tautology) continue;
+		for (k = 0; k < clause.size(); k++) resolvent.push(clause[k]);
+		redundant = rup(resolvent, resolvent.size());
+	}
+	for (uint32 i = 0; i < clause.size(); i++) marks[clause[i]] = UNDEFINED;
+	return redundant;
+}
+
+void PROOFCHECKER::insert()
+{
+	if (inconsistent) return;
+	const uint32 size = clause.size();
+	if (!size) { inconsistent = true; return; }
+	if (size == 1) {
+		const uint32 unit = clause[0];
+		const LIT_ST val = values[unit];
+		units[unit] = 1;
+		if (!val) inconsistent = true;
+		else if (UNASSIGNED(val)) {
+			assign(unit);
+			if (!propagate()) inconsistent = true;
+		}
+		return;
+	}
+	// move non-falsified literals to the watched positions
+	uint32* lits = clause;
+	for (uint32 w = 0; w < 2; w++) {
+		uint32 best = w;
+		for (uint32 k = w + 1; k < size; k++)
+			if (rank(lits[k]) > rank(lits[best])) best = k;
+		std::swap(lits[w], lits[best]);
+	}
+	const uint64 ref = arena.size();
+	arena.push(size << 1);
+	for (uint32 k = 0; k < size; k++) arena.push(lits[k]);
+	table.insert(std::make_pair(hash(lits, size), ref));
+	watch(ref);
+	const LIT_ST first = values[lits[0]], second = values[lits[1]];
+	if (!first) inconsistent = true;
+	else if (!second && UNASSIGNED(first)) {
+		assign(lits[0]);
+		if (!propagate()) inconsistent = true;
+	}
+}
+
+void PROOFCHECKER::remove()
+{
+	const uint32 size = clause.size();
+	if (size < 2) return; // units are never deleted
+	for (uint32 k = 0; k < size; k++) marks[clause[k]] = 1;
+	auto range = table.equal_range(hash(clause, size));
+	auto found = range.second;
+	for (auto it = range.first; it != range.second && found == range.second; it++) {
+		const uint32* c = arena + it->second;
+		if ((*c >> 1) != size) continue;
+		uint32 k = 0;
+		while (k < size && marks[c[k + 1]] > 0) k++;
+		if (k == size) found = it;
+	}
+	for (uint32 k = 0; k < size; k++) marks[clause[k]] = UNDEFINED;
+	if (found == range.second) { nmissing++; return; }
+	arena[found->second] |= CHECK_DELETED;
+	table.erase(found);
+	garbage += size + 1;
+	ndeleted++;
+	if (garbage > (arena.size() >> 1)) collect();
+}
+
+void PROOFCHECKER::collect()
+{
+	Vec<uint32, uint64> live;
+	live.reserve(arena.size() - garbage);
+	table.clear();
+	for (uint32 i = 0; i < watches.size(); i++) watches[i].clear();
+	uint64 ref = 0;
+	while (ref < arena.size()) {
+		const uint32* c = arena + ref;
+		const uint32 size = *c >> 1;
+		ref += size + 1;
+		if (*c & CHECK_DELETED) continue;
+		const uint64 moved = live.size();
+		for (uint32 k = 0; k <= size; k++) live.push(c[k]);
+		table.insert(std::make_pair(hash(c + 1, size), moved));
+	}
+	live.migrateTo(arena);
+	garbage = 0;
+	for (ref = 0; ref < arena.size(); ref += (arena[ref] >> 1) + 1)
+		watch(ref);
+}
+
+void PROOFCHECKER::process(const uint32& type, const uint32* lits, const uint32& size)
+{
+	const bool nontautology = import(lits, size);
+	clause.clear();
+	for (uint32 i = 0; i < resolvent.size(); i++) clause.push(resolvent[i]);
+	if (type == CHECK_DELETE) {
+		if (nontautology) remove();
+		return;
+	}
+	if (type == CHECK_ORIGINAL) noriginals++;
+	else {
+		assert(type == CHECK_ADD);
+		nlemmas++;
+		if (failed.load(std::memory_order_relaxed)) return;
+		if (nontautology && !rup(clause, clause.size())) {
+			if (rat()) nrats++;
+			else {
+				failedat = nlemmas;
+				failure.clear();
+				for (uint32 i = 0; i < clause.size(); i++) failure.push(clause[i]);
+				failed.store(true, std::memory_order_release);
+				return;
+			}
+		}
+		if (!clause.size()) refuted = true;
+	}
+	if (nontautology) insert();
+}
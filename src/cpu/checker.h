@@ -0,0 +1,150 @@
+/***********************************************************************[checker.h]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#ifndef __CHECKER_
+#define __CHECKER_
+
+#include "vector.h"
+#include "definitions.h"
+#include <unordered_map>
+#include <atomic>
+#include <thread>
+#include <chrono>
+
+namespace pFROST {
+
+	#define CHECK_QUEUE		(1ULL << 22) // words
+	#define CHECK_ORIGINAL	0
+	#define CHECK_ADD		1
+	#define CHECK_DELETE	2
+	#define CHECK_DELETED	1 // clause header flag
+
+	struct CWATCH {
+		uint64 ref;
+		uint32 blocker;
+		CWATCH() : ref(0), blocker(0) {}
+		CWATCH(const uint64& ref, const uint32& blocker) : ref(ref), blocker(blocker) {}
+	};
+	typedef Vec<CWATCH> CWL;
+
+	/*****************************************************/
+	/*  Usage: forward checker of the proof lines run by */
+	/*         a background thread; lines are fed in     */
+	/*         input numbering through a single-producer */
+	/*         single-consumer lock-free queue as a      */
+	/*         header word (size << 2 | type) + literals */
+	/*****************************************************/
+	class PROOFCHECKER {
+		// lock-free queue
+		uint32* ring;
+		alignas(64) std::atomic<uint64> head;
+		alignas(64) std::atomic<uint64> tail;
+		alignas(64) uint64 produced, freed;
+		std::atomic<bool> stopped;
+		std::thread* worker;
+		uint64 nstalls;
+		double stalltime;
+		// checker state (owned by the worker)
+		Vec<uint32, uint64> arena;
+		std::unordered_multimap<uint64, uint64> table;
+		Vec<CWL> watches;
+		Vec<LIT_ST> values, marks, units;
+		uVec1D trail, line, clause, resolvent, failure;
+		uint64 garbage, noriginals, nlemmas, nrats, ndeleted, nmissing, failedat;
+		uint32 propagated;
+		bool inconsistent, refuted;
+		std::atomic<bool> failed;
+
+		inline void		wait		(const uint64& words) {
+			if (produced + words - freed <= CHECK_QUEUE) return;
+			const auto start = std::chrono::steady_clock::now();
+			while (produced + words - (freed = head.load(std::memory_order_acquire)) > CHECK_QUEUE)
+				std::this_thread::yield();
+			stalltime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			nstalls++;
+		}
+		inline uint64	hash		(const uint32* lits, const uint32& size) const {
+			uint64 h = 0;
+			for (uint32 i = 0; i < size; i++) {
+				uint64 x = lits[i] * 0x9E3779B97F4A7C15ULL;
+				x ^= x >> 29;
+				h += x; // order-independent
+			}
+			return h;
+		}
+		inline void		assign		(const uint32& lit) {
+			assert(UNASSIGNED(values[lit]));
+			values[lit] = 1, values[FLIP(lit)] = 0;
+			trail.push(lit);
+		}
+		// true > unassigned > false
+		inline int		rank		(const uint32& lit) const {
+			const LIT_ST val = values[lit];
+			return val > 0 ? 2 : UNASSIGNED(val) ? 1 : 0;
+		}
+		inline void		watch		(const uint64& ref) {
+			const uint32* lits = arena + ref + 1;
+			watches[lits[0]].push(CWATCH(ref, lits[1]));
+			watches[lits[1]].push(CWATCH(ref, lits[0]));
+		}
+		void			run			();
+		void			process		(const uint32&, const uint32*, const uint32&);
+		void			grow		(const uint32&);
+		bool			import		(const uint32*, const uint32&);
+		bool			propagate	();
+		void			backtrack	(const uint32&);
+		bool			rup			(const uint32*, const uint32&);
+		bool			rat			();
+		void			insert		();
+		void			remove		();
+		void			collect		();
+
+	public:
+		PROOFCHECKER();
+		~PROOFCHECKER() { stop(); }
+		inline bool		active		() const { return worker != NULL; }
+		inline bool		error		() const { return failed.load(std::memory_order_acquire); }
+		inline bool		verified	() const { return !error() && refuted; }
+		inline uint64	originals	() const { return noriginals; }
+		inline uint64	lemmas		() const { return nlemmas; }
+		inline uint64	rats		() const { return nrats; }
+		inline uint64	deleted		() const { return ndeleted; }
+		inline uint64	missing		() const { return nmissing; }
+		inline uint64	failedLemma	() const { return failedat; }
+		inline uVec1D&	failedClause() { return failure; }
+		inline uint64	stalls		() const { return nstalls; }
+		inline double	stallTime	() const { return stalltime; }
+		// producer side: reserves a line of 'size' literals,
+		// fills it with 'put' and publishes it with 'commit'
+		inline void		open		(const uint32& type, const uint32& size) {
+			assert(worker != NULL);
+			assert(type <= CHECK_DELETE);
+			if (size + 1ULL > CHECK_QUEUE) PFLOGE("proof line of size %d is too large for the online checker", size);
+			wait(size + 1ULL);
+			ring[produced++ & (CHECK_QUEUE - 1)] = (size << 2) | type;
+		}
+		inline void		put			(const uint32& lit) { ring[produced++ & (CHECK_QUEUE - 1)] = lit; }
+		inline void		commit		() { tail.store(produced, std::memory_order_release); }
+		void			start		();
+		void			sync		();
+		void			stop		();
+	};
+
+}
+
+#endif
@@ -74,7 +74,7 @@ void ParaFROST::removeClause(CLAUSE& c, const C_REF& cref)
 		stats.literals.original -= size;
 		stats.shrunken += size;
 	}
-	if (opts.proof_en) proof.deleteClause(c);
+	if (opts.proof_en) proof.deleteClause(cref, c);
 	c.markDeleted();
 	cm.collectClause(cref, size);
 }
@@ -106,7 +106,7 @@ void ParaFROST::newClause(const C_REF& cref, CLAUSE& c, const bool& learnt)
 
 C_REF ParaFROST::newClause(const Lits_t& in_c, const bool& learnt)
 {
-	const C_REF r = cm.alloc(in_c);
+	const C_REF r = cm.alloc(in_c, learnt);
 	CLAUSE& c = cm[r];
 	assert(c.keep());
 	assert(!c.deleted());
@@ -119,7 +119,8 @@ void ParaFROST::newHyper2()
 {
 	assert(learntC.size() == 2);
 	stats.binary.resolvents++;
-	const C_REF r = cm.alloc(learntC);
+	const C_REF r = cm.alloc(learntC, true);
+	if (proof.lrat()) proof.bind(r);
 	CLAUSE& c = cm[r];
 	const uint32 first = c[0], second = c[1];
 	delayWatch(first, second, r, 2);
@@ -135,7 +136,8 @@ void ParaFROST::newHyper3(const bool& learnt)
 	const int size = learntC.size();
 	assert(size > 1 && size <= 3);
 	last.ternary.resolvents++;
-	const C_REF r = cm.alloc(learntC);
+	const C_REF r = cm.alloc(learntC, learnt);
+	if (proof.lrat()) proof.bind(r);
 	CLAUSE& c = cm[r];
 	sp->learntLBD = size;
 	newClause(r, c, learnt);
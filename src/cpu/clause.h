@@ -186,6 +186,7 @@ namespace pFROST {
 		}
 	};
 	const size_t hc_isize = sizeof(uint32);
+	#define IDWORDS 2 // words of an LRAT identifier preceding a clause
 	const size_t hc_csize = sizeof(CLAUSE);
 
 #if defined(_WIN32)
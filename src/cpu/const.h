@@ -31,7 +31,12 @@ namespace pFROST {
 	#define MBYTE			0x00100000
 	#define KBYTE			0x00000400
 	#define GBYTE			0x40000000
+#if defined(COMPACTREF)
+	#define NOREF			UINT32_MAX
+#else
 	#define NOREF			UINT64_MAX
+#endif
+	#define MAXREF			(NOREF >> 1)
 	#define NOVAR			UINT32_MAX
 	#define INIT_CAP		32
 	#define UNDEFINED		-1
@@ -50,6 +50,27 @@ namespace pFROST {
 		return memUsed;
 	}
 
+	int64 sysHugeMemUsed()
+	{
+		int64 memUsed = 0;
+#if defined(__linux__)
+		FILE* file = fopen("/proc/self/smaps_rollup", "r");
+		if (file == NULL) return 0;
+		char line[128];
+		uint32 sign = 0;
+		while (fgets(line, 128, file) != NULL) {
+			char* str = line;
+			if (eq(str, "AnonHugePages:")) {
+				eatWS(str);
+				memUsed = toInteger(str, sign);
+				break;
+			}
+		}
+		fclose(file);
+#endif
+		return memUsed * KBYTE;
+	}
+
 	int64 getAvailSysMem()
 	{
 #if defined(__linux__) || defined(__CYGWIN__)
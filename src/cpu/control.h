@@ -27,6 +27,7 @@ namespace pFROST {
 
 	void	forceFPU				();
 	int64	sysMemUsed				();
+	int64	sysHugeMemUsed			();
 	int64	getAvailSysMem			();
 	void	getBuildInfo			();
 	void	getCPUInfo				(uint64&);
@@ -33,7 +33,11 @@ namespace pFROST {
 	typedef unsigned int uint32;
 	typedef signed long long int int64;
 	typedef unsigned long long int uint64;
-	typedef size_t C_REF;
+#if defined(COMPACTREF)
+	typedef uint32 C_REF;
+#else
+	typedef uint64 C_REF;
+#endif
 	typedef void* G_REF;
 
 }
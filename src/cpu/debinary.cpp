@@ -50,6 +50,13 @@ void ParaFROST::debinary() {
 				}
 				else if (NEQUAL(marker, SIGN(other))) { // found 'hyper unary'
 					unit = FLIP(lit);
+					if (proof.lrat()) { // resolved with the binary that marked 'other'
+						const uint32 first = FLIP(other);
+						WATCH* k = ws;
+						while (!k->binary() || NEQUAL(k->imp, first) || cm.deleted(k->ref)) k++;
+						assert(k < i);
+						proof.hintClause(k->ref), proof.hintClause(cref);
+					}
 					j = ws; // the whole list is satisfied by 'unit'
 					units++;
 					break;
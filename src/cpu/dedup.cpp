@@ -0,0 +1,74 @@
+/***********************************************************************[dedup.cpp]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#include "solve.h"
+
+using namespace pFROST;
+
+// 'c' is a simplified input clause (no duplicate literals) not yet in 'cm'
+bool ParaFROST::duplicate(Lits_t& c, const uint64& key)
+{
+	assert(!parsedups.empty());
+	const int size = c.size();
+	assert(size > 1);
+	forall_clause(c, k) {
+		markLit(*k);
+	}
+	const uint64 slot = parsedups.find(key, [&](const C_REF& r) {
+		const CLAUSE& d = cm[r];
+		if (d.size() != size) return false;
+		for (int i = 0; i < size; i++) {
+			const uint32 lit = d[i];
+			if (l2marker(lit) != SIGN(lit)) return false;
+		}
+		return true;
+	});
+	forall_clause(c, k) {
+		unmarkLit(*k);
+	}
+	return slot != NOSLOT;
+}
+
+// simplified clauses are kept sorted, so equal sets have equal literal arrays
+uint64 ParaFROST::dedup()
+{
+	if (!opts.dedup_en || scnf.empty()) return 0;
+	DUPTABLE<S_REF> table;
+	table.init(scnf.size());
+	uint64 removed = 0;
+	forall_vector(S_REF, scnf, i) {
+		S_REF c = *i;
+		if (!c->original() && !c->learnt()) continue;
+		const int size = c->size();
+		const uint64 key = hashLits(c->data(), size);
+		const uint64 slot = table.find(key, [&](const S_REF& d) {
+			return d->size() == size && !memcmp(d->data(), c->data(), size * sizeof(uint32));
+		});
+		if (slot == NOSLOT) { table.insert(key, c); continue; }
+		S_REF& kept = table[slot];
+		// an original clause must survive its learnt copy
+		if (kept->learnt() && c->original()) {
+			removeClause(kept);
+			kept = c;
+		}
+		else removeClause(c);
+		removed++;
+	}
+	PFLOG2(2, "  removed %lld duplicate clauses", removed);
+	return removed;
+}
@@ -0,0 +1,92 @@
+/***********************************************************************[dedup.h]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#ifndef __DEDUP_
+#define __DEDUP_
+
+#include "vector.h"
+#include "definitions.h"
+
+namespace pFROST {
+
+	#define NOSLOT UINT64_MAX
+
+	// order-independent hash of a literal set
+	inline uint64 hashLits(const uint32* lits, const int& size)
+	{
+		uint64 h = size;
+		for (int i = 0; i < size; i++) {
+			uint64 x = lits[i] * 0x9E3779B97F4A7C15ULL;
+			x ^= x >> 32;
+			h += x * 0xD6E8FEB86659FD93ULL;
+		}
+		return h ? h : 1;
+	}
+
+	/*****************************************************/
+	/*  Usage: open-addressing index of clause references*/
+	/*         keyed by the hash of their literal sets   */
+	/*         to find exact duplicates; a slot with a   */
+	/*         zero key is free; the capacity is bounded */
+	/*         to a 3/4 load of the expected clauses     */
+	/*****************************************************/
+	template <class REF>
+	class DUPTABLE {
+		Vec<uint64, uint64> keys;
+		Vec<REF, uint64> refs;
+		uint64 cap, count;
+
+	public:
+		DUPTABLE() : cap(0), count(0) {}
+		~DUPTABLE() { destroy(); }
+		inline bool		empty		() const { return keys.empty(); }
+		inline uint64	size		() const { return count; }
+		inline uint64	bytes		() const { return cap * (sizeof(uint64) + sizeof(REF)); }
+		inline REF&		operator[]	(const uint64& slot) { return refs[slot]; }
+		// 'n' is an upper bound on the clauses to be inserted
+		inline void		init		(const uint64& n) {
+			cap = n + (n / 3) + 16;
+			keys.resize(cap, 0);
+			refs.resize(cap);
+			count = 0;
+		}
+		// returns the slot of a clause 'same' as the one hashed to 'key'
+		template <class SAME>
+		inline uint64	find		(const uint64& key, SAME same) const {
+			assert(key);
+			for (uint64 i = key % cap; keys[i]; i = (i + 1 == cap) ? 0 : i + 1)
+				if (keys[i] == key && same(refs[i])) return i;
+			return NOSLOT;
+		}
+		inline void		insert		(const uint64& key, const REF& ref) {
+			assert(key);
+			assert(count + 1 < cap);
+			uint64 i = key % cap;
+			while (keys[i]) i = (i + 1 == cap) ? 0 : i + 1;
+			keys[i] = key, refs[i] = ref;
+			count++;
+		}
+		inline void		destroy		() {
+			keys.clear(true), refs.clear(true);
+			cap = count = 0;
+		}
+	};
+
+}
+
+#endif
@@ -18,6 +18,8 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "solve.h"
 #include "dimacs.h"
+#include "stream.h"
+#include "snapshot.h"
 #include "control.h"
 
 using namespace pFROST;
@@ -26,81 +28,90 @@ bool ParaFROST::parser()
 {
 	FAULT_DETECTOR;
 	struct stat st;
-	if (!canAccess(formula.path.c_str(), st)) PFLOGE("cannot access the input file");
-	const uint64 fsz = formula.size = st.st_size;
-	PFLOG2(1, " Parsing CNF file \"%s%s%s\" (size: %s%lld MB%s)",
-		CREPORTVAL, formula.path.c_str(), CNORMAL, CREPORTVAL, ratio(fsz, uint64(MBYTE)), CNORMAL);
-	timer.start();
-#if defined(__linux__) || defined(__CYGWIN__)
-	int fd = open(formula.path.c_str(), O_RDONLY, 0);
-	if (fd == -1) PFLOGE("cannot open input file");
-	void* buffer = mmap(NULL, fsz, PROT_READ, MAP_PRIVATE, fd, 0);
-	char* str = (char*)buffer;
-#else
-	ifstream inputFile;
-	inputFile.open(formula.path, ifstream::in);
-	if (!inputFile.is_open()) PFLOGE("cannot open input file");
-	char* buffer = pfcalloc<char>(fsz + 1), * str = buffer;
-	inputFile.read(buffer, fsz);
-	buffer[fsz] = '\0';
-#endif
+	const char* command = NULL;
+	const bool stdinput = formula.path == "-";
+	if (!stdinput && !canAccess(formula.path.c_str(), st)) PFLOGE("cannot access the input file");
 	Lits_t in_c, org;
+	if (!stdinput && S_ISREG(st.st_mode) && isSnapshot(formula.path.c_str()))
+		return readSnapshot(st.st_size);
+	if (opts.parseincr_en) {
+		if (proof.lrat()) PFLOGE("incremental parsing is not supported with LRAT proofs");
+		// the incremental solver has no elimination or substitution support
+		if (opts.sigma_en || opts.sigma_live_en || opts.decompose_en) {
+			PFLOG2(2, "  Disabling sigma and decompose in incremental mode");
+			opts.sigma_en = opts.sigma_live_en = opts.decompose_en = false;
+		}
+	}
+	if (opts.modelverify_en && opts.model_image) model.image.init(opts.model_image);
 	in_c.reserve(INIT_CAP);
 	org.reserve(INIT_CAP);
-	PFLMEMCALL(this, 2);
-	char* eof = str + fsz;
-	while (str < eof) {
-		eatWS(str);
-		if (*str == '\0' || *str == '0' || *str == '%') break;
-		if (*str == 'c') eatLine(str);
-		else if (*str == 'p') {
-			if (!eq(str, "p cnf")) PFLOGE("header has wrong format");
-			uint32 sign = 0;
-			inf.orgVars = toInteger(str, sign);
-			if (!opts.parseincr_en) {
-				inf.unassigned = inf.maxVar = inf.orgVars;
-				inf.nDualVars = V2L(inf.orgVars + 1);
-			}
-			if (sign) PFLOGE("number of variables in header is negative");
-			if (inf.orgVars == 0) PFLOGE("zero number of variables in header");
-			if (inf.orgVars >= INT_MAX - 1) PFLOGE("number of variables not supported");
-			inf.nOrgCls = toInteger(str, sign);
-			if (sign) PFLOGE("number of clauses in header is negative");
-			if (inf.nOrgCls == 0) PFLOGE("zero number of clauses in header");
-			PFLOG2(1, " Found header %s%d %d%s", CREPORTVAL, inf.orgVars, inf.nOrgCls, CNORMAL);
-			assert(orgs.empty());
-			if (!opts.parseincr_en) {
-				allocSolver();
-				initQueue();
-				initHeap();
-				initVars();
-				assert(vorg.size() == inf.maxVar + 1);
-				model.init(vorg);
-				if (opts.proof_en) 
-					proof.init(sp, vorg);
+	if (stdinput || !S_ISREG(st.st_mode) || (command = decompressor(formula.path.c_str())) != NULL) {
+		PFLOG2(1, " Parsing CNF %s \"%s%s%s\"%s", command ? "compressed file" : "stream",
+			CREPORTVAL, stdinput ? "<stdin>" : formula.path.c_str(), CNORMAL, command ? " via decompressor" : "");
+		timer.start();
+		if (!parseStream(command, in_c, org)) return false;
+	}
+	else {
+		const uint64 fsz = formula.size = st.st_size;
+		PFLOG2(1, " Parsing CNF file \"%s%s%s\" (size: %s%lld MB%s)",
+			CREPORTVAL, formula.path.c_str(), CNORMAL, CREPORTVAL, ratio(fsz, uint64(MBYTE)), CNORMAL);
+		timer.start();
+#if defined(__linux__) || defined(__CYGWIN__)
+		int fd = open(formula.path.c_str(), O_RDONLY, 0);
+		if (fd == -1) PFLOGE("cannot open input file");
+		void* buffer = mmap(NULL, fsz, PROT_READ, MAP_PRIVATE, fd, 0);
+		char* str = (char*)buffer;
+#else
+		ifstream inputFile;
+		inputFile.open(formula.path, ifstream::in);
+		if (!inputFile.is_open()) PFLOGE("cannot open input file");
+		char* buffer = pfcalloc<char>(fsz + 1), * str = buffer;
+		inputFile.read(buffer, fsz);
+		buffer[fsz] = '\0';
+#endif
+		PFLMEMCALL(this, 2);
+		char* eof = str + fsz;
+		while (str < eof) {
+			eatWS(str);
+			if (*str == '\0' || *str == '0' || *str == '%') break;
+			if (*str == 'c') eatLine(str);
+			else if (*str == 'p') {
+				if (eqn(str, "p inccnf")) {
+					parseICNF(str, eof, in_c, org);
+					break;
+				}
+				parseHeader(str, eof);
+				if (!opts.parseincr_en && opts.parse_threads > 1) {
+					if (!parseChunks(str, eof, in_c, org)) return false;
+					break;
+				}
 			}
-		}
-		else if (!toClause(in_c, org, str)) return false;
-		else if (opts.parseincr_en) {
-			incremental = true;
-			uint32 v = 0, s = 0;
-			while ((v = toInteger(str, s)) != 0) {
-				while (v > inf.maxVar) iadd();
-				org.push(V2DEC(v, s));
+			else if (opts.parseincr_en) {
+				// no solver is allocated yet, so variables are added as they appear
+				incremental = true;
+				uint32 v = 0, s = 0;
+				while ((v = toInteger(str, s)) != 0) {
+					while (v > inf.maxVar) iadd();
+					org.push(V2DEC(v, s));
+				}
+				if (!itoClause(in_c, org)) return false;
 			}
-			if (!itoClause(in_c, org)) return false;
+			else if (!toClause(in_c, org, str)) return false;
 		}
-	}
 #if defined(__linux__) || defined(__CYGWIN__)
-	if (munmap(buffer, fsz) != 0) PFLOGE("cannot clean input file %s mapping", formula.path.c_str());
-	close(fd);
+		if (munmap(buffer, fsz) != 0) PFLOGE("cannot clean input file %s mapping", formula.path.c_str());
+		close(fd);
 #else
-	free(buffer);
-	inputFile.close();
+		free(buffer);
+		inputFile.close();
 #endif
-	assert(stats.clauses.original == orgs.size());
+	}
+	assert(formula.icnf || stats.clauses.original == orgs.size());
 	assert(orgs.size() <= inf.nOrgCls);
 	orgs.shrinkCap();
+	const uint64 dupbytes = parsedups.bytes();
+	parsedups.destroy();
+	model.image.shrinkCap();
 	in_c.clear(true), org.clear(true);
 	timer.stop();
 	timer.parse = timer.cpuTime();
@@ -115,20 +126,292 @@ bool ParaFROST::parser()
 		CREPORTVAL, formula.ternaries, CNORMAL, 
 		CREPORTVAL, formula.large, CNORMAL);
 	PFLOG2(1, "  maximum clause size: %s%d%s", CREPORTVAL, formula.maxClauseSize, CNORMAL);
+	if (opts.dedup_en)
+		PFLOG2(1, "  removed %s%lld duplicated clauses%s using a %s%.2f MB%s table", 
+			CREPORTVAL, stats.duplicates.parsed, CNORMAL, CREPORTVAL, ratio(double(dupbytes), double(MBYTE)), CNORMAL);
+	if (model.image.enabled())
+		PFLOG2(1, "  kept %s image of input clauses in %s%.2f MB%s", model.image.mode() == IMAGE_COMPRESSED ? "a compressed" : "an",
+			CREPORTVAL, double(model.image.bytes()) / MBYTE, CNORMAL);
+	return true;
+}
+
+void ParaFROST::parseHeader(char*& str, char* eof)
+{
+	if (!eq(str, "p cnf")) PFLOGE("header has wrong format");
+	uint32 sign = 0;
+	inf.orgVars = toInteger(str, sign);
+	if (sign) PFLOGE("number of variables in header is negative");
+	if (inf.orgVars == 0) PFLOGE("zero number of variables in header");
+	if (inf.orgVars >= INT_MAX - 1) PFLOGE("number of variables not supported");
+	inf.nOrgCls = toInteger(str, sign);
+	if (sign) PFLOGE("number of clauses in header is negative");
+	if (inf.nOrgCls == 0) PFLOGE("zero number of clauses in header");
+	PFLOG2(1, " Found header %s%d %d%s", CREPORTVAL, inf.orgVars, inf.nOrgCls, CNORMAL);
+	assert(orgs.empty());
+	if (!opts.parseincr_en) {
+		inf.maxVar = inf.orgVars;
+		if (opts.parsecompact_en) {
+			if (eof) compactVars(str, eof);
+			else PFLOG2(2, "  Variable compaction is not supported on streamed input");
+		}
+		inf.unassigned = inf.maxVar;
+		inf.nDualVars = V2L(inf.maxVar + 1);
+		allocSolver();
+		initQueue();
+		initHeap();
+		initVars();
+		assert(vorg.size() == inf.maxVar + 1);
+		model.init(vorg);
+		if (opts.proof_en) 
+			proof.init(sp, vorg);
+		if (proof.lrat())
+			proof.initLRAT(inf.orgVars, inf.nOrgCls, cm, spool);
+		if (opts.dedup_en)
+			parsedups.init(inf.nOrgCls);
+	}
+}
+
+// map the variables occurring in the input to consecutive solver variables
+void ParaFROST::compactVars(char* str, char* eof)
+{
+	Vec<Byte> used(inf.orgVars + 1, 0);
+	scanVars(str, eof, inf.orgVars, used);
+	uint32 maxVar = 0;
+	for (uint32 v = 1; v <= inf.orgVars; v++) 
+		if (used[v]) maxVar++;
+	if (!maxVar || maxVar == inf.orgVars) return;
+	PFLOG2(1, "  compacting %s%d variables to %d used ones%s", CREPORTVAL, inf.orgVars, maxVar, CNORMAL);
+	model.maxVar = inf.orgVars;
+	model.lits.resize(inf.orgVars + 1), model.lits[0] = 0;
+	maxVar = 0;
+	for (uint32 v = 1; v <= inf.orgVars; v++)
+		model.lits[v] = used[v] ? V2L(++maxVar) : 0;
+	inf.maxVar = maxVar;
+	formula.compacted = true;
+}
+
+// replay an incremental session: solve under each cube 'a <lits> 0' the clauses read so far
+void ParaFROST::parseICNF(char*& str, char* eof, Lits_t& in_c, Lits_t& org)
+{
+	if (proof.lrat()) PFLOGE("incremental parsing is not supported with LRAT proofs");
+	eatLine(str);
+	uint32 maxVar = 0;
+	scanICNF(str, eof, maxVar, inf.nOrgCls);
+	if (maxVar >= INT_MAX - 1) PFLOGE("number of variables not supported");
+	PFLOG2(1, " Found incremental header with %s%d variables and %d clauses%s", CREPORTVAL, maxVar, inf.nOrgCls, CNORMAL);
+	formula.icnf = incremental = true;
+	// later blocks may refer to any variable, so none can be eliminated or substituted
+	if (opts.sigma_en || opts.sigma_live_en || opts.decompose_en) {
+		PFLOG2(2, "  Disabling sigma and decompose in incremental mode");
+		opts.sigma_en = opts.sigma_live_en = opts.decompose_en = false;
+	}
+	while (inf.maxVar < maxVar) iadd();
+	Lits_t cube;
+	uint32 v = 0, s = 0, calls = 0;
+	bool unsat = false;
+	while (str < eof) {
+		eatWS(str);
+		if (*str == '\0' || *str == '%') break;
+		if (*str == 'c') eatLine(str);
+		else if (*str == 'p') PFLOGE("found more than one header");
+		else if (*str == 'a') {
+			str++;
+			uint32 contradict = 0;
+			while ((v = toInteger(str, s)) != 0) {
+				const uint32 mlit = V2DEC(ABS(imap(v)), s);
+				imarks.expand(v + 1, UNDEFINED);
+				LIT_ST& mark = imarks[v];
+				if (UNASSIGNED(mark)) mark = s, cube.push(mlit);
+				else if (NEQUAL(mark, s)) contradict = mlit;
+			}
+			forall_clause(cube, k) {
+				imarks[vorg[ABS(*k)]] = UNDEFINED;
+			}
+			PFLOG2(1, " Solving incremental call %d under %d assumptions", ++calls, cube.size());
+			iconflict.clear();
+			if (unsat) cnfstate = UNSAT, wrapup();
+			else if (!inf.maxVar) PFLOGS("SATISFIABLE"); // nothing to assign
+			else if (contradict) {
+				PFLOG2(2, "  Assumption %d contradicts another one", l2i(contradict));
+				iconflict.push(contradict), iconflict.push(FLIP(contradict));
+				cnfstate = UNSAT, wrapup();
+				cnfstate = UNSOLVED_M;
+			}
+			else {
+				isolve(cube);
+				if (interrupted()) break;
+				if (cnfstate == UNSAT && iconflict.empty()) unsat = true;
+				else iunassume();
+			}
+			cube.clear();
+		}
+		else {
+			while ((v = toInteger(str, s)) != 0) org.push(V2DEC(v, s));
+			if (unsat) org.clear();
+			else if (!itoClause(in_c, org)) {
+				if (cnfstate) learnEmpty();
+				in_c.clear(), org.clear();
+				unsat = true;
+			}
+		}
+	}
+	PFLOG2(1, " Replayed %s%d incremental calls%s", CREPORTVAL, calls, CNORMAL);
+}
+
+bool ParaFROST::parseStream(const char* command, Lits_t& in_c, Lits_t& org)
+{
+	if (opts.parseincr_en) PFLOGE("incremental parsing of streamed input is not supported");
+	formula.streamed = true;
+	if (command != NULL && !decompressorAvailable(command))
+		PFLOGE("decompressor \"%s\" not available", decompressorTool(command).c_str());
+	BLOCKREADER reader;
+	if (!reader.open(formula.path, command)) {
+		const char* sniffed = reader.compressed();
+		if (sniffed == NULL) PFLOGE("cannot open input stream");
+		if (!decompressorAvailable(sniffed)) PFLOGE("decompressor \"%s\" not available", decompressorTool(sniffed).c_str());
+		PFLOGE("compressed input on stdin is not supported");
+	}
+	if (command == NULL && (command = reader.compressed()) != NULL)
+		PFLOG2(1, "  Detected %s%s%s compressed stream", CREPORTVAL, decompressorTool(command).c_str(), CNORMAL);
+	PFLMEMCALL(this, 2);
+	char* str = NULL, * eob = NULL;
+	bool header = false;
+	while (!header && reader.next(str, eob)) {
+		while (str < eob) {
+			eatWS(str);
+			if (*str == '\0') break;
+			if (*str == 'c') eatLine(str);
+			else if (*str == 'p') {
+				if (eqn(str, "p inccnf")) PFLOGE("incremental parsing of streamed input is not supported");
+				parseHeader(str, NULL);
+				header = true;
+				break;
+			}
+			else PFLOGE("expected a header but ASCII(%d) is found", *str);
+		}
+	}
+	if (!header) {
+		// an empty stream is often a decompressor that could not run
+		const int status = reader.close();
+		if (command != NULL && status == 127) PFLOGE("decompressor \"%s\" not available", decompressorTool(command).c_str());
+		if (command != NULL && status) PFLOGE("decompressing \"%s\" failed with exit status %d", formula.path.c_str(), status);
+		PFLOGE("header is missing");
+	}
+	PARSECHUNK block;
+	bool sat = true, eoc = false;
+	do {
+		block.head = str, block.tail = eob;
+		tokenize(block, inf.orgVars);
+		if (!toClauses(block, in_c, org, eoc)) { sat = false; break; }
+		if (block.error) PFLOGE(block.error, block.errch);
+	} while (!eoc && reader.next(str, eob));
+	const int status = reader.close();
+	formula.size = reader.bytes();
+	if (status) PFLOGE("decompressing \"%s\" failed with exit status %d", formula.path.c_str(), status);
+	if (sat && !org.empty()) PFLOGE("last clause is not terminated by zero");
+	return sat;
+}
+
+bool ParaFROST::toClauses(PARSECHUNK& chunk, Lits_t& in_c, Lits_t& org, bool& eoc)
+{
+	uint32* lit = chunk.lits, * end = chunk.lits.end();
+	while (lit != end) {
+		if (*lit) org.push(*lit);
+		else if (org.empty()) { eoc = true; return true; }
+		else if (!toClause(in_c, org)) return false;
+		lit++;
+	}
+	if (chunk.eof) eoc = true;
 	return true;
 }
 
+bool ParaFROST::parseChunks(char*& str, char* eof, Lits_t& in_c, Lits_t& org)
+{
+	assert(opts.parse_threads > 1);
+	assert(org.empty());
+	const uint64 bytes = eof - str;
+	const int nthreads = opts.parse_threads;
+	uint64 chunksize = bytes / (uint64(nthreads) << 2);
+	if (chunksize < PARSE_CHUNK_MIN) chunksize = PARSE_CHUNK_MIN;
+	else if (chunksize > PARSE_CHUNK_MAX) chunksize = PARSE_CHUNK_MAX;
+	const uint32 maxchunks = uint32(bytes / chunksize) + 1;
+	PARSECHUNK* chunks = new PARSECHUNK[maxchunks];
+	uint32 nchunks = 0;
+	char* head = str;
+	while (head < eof) {
+		char* tail = uint64(eof - head) > chunksize ? head + chunksize : eof;
+		while (tail < eof && *tail++ != '\n');
+		assert(nchunks < maxchunks);
+		chunks[nchunks].head = head, chunks[nchunks].tail = tail;
+		nchunks++, head = tail;
+	}
+	PFLOG2(2, "  splitting %lld bytes into %d chunks over %d threads..", bytes, nchunks, nthreads);
+	CHUNKQUEUE queue(chunks, nchunks, uint32(nthreads) << 1);
+	const uint32 maxVar = inf.orgVars;
+	Vec<std::thread*> workers;
+	for (int t = 0; t < nthreads; t++) {
+		workers.push(new std::thread([&queue, chunks, nchunks, maxVar]() {
+			uint32 idx;
+			while ((idx = queue.take()) < nchunks) {
+				tokenize(chunks[idx], maxVar);
+				queue.done(idx);
+			}
+		}));
+	}
+	// merge chunks in file order to keep clause order deterministic
+	bool sat = true, eoc = false;
+	const char* error = NULL;
+	int errch = 0;
+	for (uint32 i = 0; i < nchunks && sat && !eoc && !error; i++) {
+		queue.wait(i);
+		PARSECHUNK& chunk = chunks[i];
+		if (!toClauses(chunk, in_c, org, eoc)) sat = false;
+		else if (chunk.error) error = chunk.error, errch = chunk.errch;
+		chunk.lits.clear(true);
+		queue.consumed();
+	}
+	queue.stop();
+	for (uint32 t = 0; t < workers.size(); t++) {
+		workers[t]->join();
+		delete workers[t];
+	}
+	workers.clear(true);
+	delete[] chunks;
+	if (error) PFLOGE(error, errch);
+	if (sat && !org.empty()) PFLOGE("last clause is not terminated by zero");
+	str = eof;
+	return sat;
+}
+
 bool ParaFROST::toClause(Lits_t& c, Lits_t& org, char*& str)
 {
 	assert(c.empty());
 	assert(org.empty());
 	uint32 v = 0, s = 0;
-	bool satisfied = false;
 	while ((v = toInteger(str, s)) != 0) {
-		if (v > inf.maxVar) PFLOGE("too many variables");
-		uint32 lit = V2DEC(v, s);
+		if (v > inf.orgVars) PFLOGE("too many variables");
+		org.push(V2DEC(v, s));
+	}
+	return toClause(c, org);
+}
+
+bool ParaFROST::toClause(Lits_t& c, Lits_t& org)
+{
+	assert(c.empty());
+	if (model.image.enabled()) model.image.push(org);
+	if (proof.checking()) proof.checkOriginal(org);
+	if (formula.compacted) {
+		forall_clause(org, k) {
+			const uint32 mlit = model.lits[ABS(*k)];
+			CHECKLIT(mlit);
+			*k = V2DEC(ABS(mlit), SIGN(*k));
+		}
+	}
+	const uint64 id = proof.lrat() ? proof.original() : 0;
+	bool satisfied = false;
+	forall_clause(org, k) {
+		const uint32 lit = *k;
 		CHECKLIT(lit);
-		org.push(lit);
 		// checking literal
 		LIT_ST marker = l2marker(lit);
 		if (UNASSIGNED(marker)) {
@@ -136,6 +419,7 @@ bool ParaFROST::toClause(Lits_t& c, Lits_t& org, char*& str)
 			LIT_ST val = sp->value[lit];
 			if (UNASSIGNED(val)) c.push(lit);
 			else if (val) satisfied = true;
+			else if (id) proof.hintUnit(lit);
 		}
 		else if (marker != SIGN(lit)) satisfied = true; // tautology
 	}
@@ -143,14 +427,21 @@ bool ParaFROST::toClause(Lits_t& c, Lits_t& org, char*& str)
 		unmarkLit(*k);
 	}
 	if (satisfied) {
-		if (opts.proof_en) proof.deleteClause(org);
+		if (id) proof.clearHints(), proof.deleteID(id);
+		else if (opts.proof_en) proof.deleteClause(org);
 	}
 	else {
-		if (org.empty()) { 
-			if (opts.proof_en) proof.addEmpty();
-			return false; 
-		}
 		int newsize = c.size();
+		if (!newsize) {
+			// empty or falsified by earlier units, the caller learns the empty clause
+			if (id) proof.hint(id);
+			PFLOG2(2, "  original clause became empty after parsing.");
+			return false;
+		}
+		if (id) {
+			if (newsize < org.size()) proof.hint(id);
+			else if (newsize == 1) proof.bindUnit(*c, id);
+		}
 		if (newsize == 1) {
 			const uint32 unit = *c;
 			CHECKLIT(unit);
@@ -159,17 +450,33 @@ bool ParaFROST::toClause(Lits_t& c, Lits_t& org, char*& str)
 			else if (!val) return false;
 		}
 		else if (orgs.size() + 1 > inf.nOrgCls) PFLOGE("too many clauses");
-		else if (newsize) {
+		else {
+			const uint64 key = parsedups.empty() ? 0 : hashLits(c, newsize);
+			if (key && duplicate(c, key)) {
+				if (id) proof.clearHints(), proof.deleteID(id);
+				else if (opts.proof_en) proof.deleteClause(org);
+				stats.duplicates.parsed++;
+				c.clear(), org.clear();
+				return true;
+			}
 			if (newsize == 2) formula.binaries++;
 			else if (newsize == 3) formula.ternaries++;
 			else assert(newsize > 3), formula.large++;
 			if (newsize > formula.maxClauseSize)
 				formula.maxClauseSize = newsize;
-			newClause(c, false);
+			const C_REF r = newClause(c, false);
+			if (key) parsedups.insert(key, r);
+			if (id) {
+				if (newsize < org.size()) proof.addClause(c), proof.bind(r);
+				else proof.bind(r, id);
+			}
 		}
 		if (opts.proof_en && newsize < org.size()) {
-			proof.addClause(c);
-			proof.deleteClause(org);
+			if (id) proof.deleteID(id);
+			else {
+				proof.addClause(c);
+				proof.deleteClause(org);
+			}
 			org.clear();
 		}
 	}
@@ -23,15 +23,22 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "definitions.h"
 #include <fcntl.h>
 #include <sys/stat.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 namespace pFROST {
 
+	#define PARSE_CHUNK_MIN	(64 * KBYTE)
+	#define PARSE_CHUNK_MAX	(64 * MBYTE)
+
 	struct FORMULA {
 		string path;
 		double c2v;
 		uint64 size;
 		uint32 units, large, binaries, ternaries;
 		int maxClauseSize;
+		bool streamed, restored, sigmified, icnf, compacted;
 		FORMULA() : 
 			path()
 			, c2v(0)
@@ -40,7 +47,12 @@ namespace pFROST {
 			, large(0)
 			, binaries(0)
 			, ternaries(0)
-			, maxClauseSize(0) {}
+			, maxClauseSize(0)
+			, streamed(false)
+			, restored(false)
+			, sigmified(false)
+			, icnf(false)
+			, compacted(false) {}
 		FORMULA(const string& path) :
 			path(path)
 			, c2v(0)
@@ -49,7 +61,12 @@ namespace pFROST {
 			, large(0)
 			, binaries(0)
 			, ternaries(0)
-			, maxClauseSize(0) {}
+			, maxClauseSize(0)
+			, streamed(false)
+			, restored(false)
+			, sigmified(false)
+			, icnf(false)
+			, compacted(false) {}
 	};
 
 	inline bool isDigit(const char& ch) { return (ch ^ '0') <= 9; }
@@ -70,6 +87,135 @@ namespace pFROST {
 		return n;
 	}
 
+	// mark the variables occurring in the clauses of a DIMACS buffer
+	inline void scanVars(char* str, char* eof, const uint32& maxVar, Byte* used)
+	{
+		uint32 v = 0, sign = 0;
+		while (str < eof) {
+			eatWS(str);
+			if (*str == '\0' || *str == '%') break;
+			if (*str == 'c') { eatLine(str); continue; }
+			if ((v = toInteger(str, sign)) > maxVar) PFLOGE("too many variables");
+			used[v] = 1;
+		}
+	}
+
+	// find the largest variable and count the clauses of an iCNF buffer
+	inline void scanICNF(char* str, char* eof, uint32& maxVar, uint32& nClauses)
+	{
+		uint32 v = 0, sign = 0;
+		maxVar = nClauses = 0;
+		while (str < eof) {
+			eatWS(str);
+			if (*str == '\0' || *str == '%') break;
+			if (*str == 'c' || *str == 'p') { eatLine(str); continue; }
+			const bool cube = *str == 'a';
+			if (cube) str++;
+			while ((v = toInteger(str, sign)) != 0)
+				if (v > maxVar) maxVar = v;
+			if (!cube) nClauses++;
+		}
+	}
+
+	/*****************************************************/
+	/*  Usage: a line-aligned slice of the input buffer  */
+	/*         tokenized into literals by a parser thread*/
+	/*****************************************************/
+	struct PARSECHUNK {
+		char* head, * tail;
+		uVec1D lits;
+		const char* error;
+		int errch;
+		bool eof, ready;
+		PARSECHUNK() :
+			head(NULL)
+			, tail(NULL)
+			, error(NULL)
+			, errch(0)
+			, eof(false)
+			, ready(false) {}
+	};
+
+	/*****************************************************/
+	/*  Usage: hands out chunks to parser threads within */
+	/*         a bounded window ahead of the merger      */
+	/*****************************************************/
+	class CHUNKQUEUE {
+		std::mutex lock;
+		std::condition_variable workcv, readycv;
+		PARSECHUNK* chunks;
+		uint32 nchunks, next, merged, window;
+		bool stopped;
+	public:
+		CHUNKQUEUE(PARSECHUNK* chunks, const uint32& nchunks, const uint32& window) :
+			chunks(chunks)
+			, nchunks(nchunks)
+			, next(0)
+			, merged(0)
+			, window(window)
+			, stopped(false) {}
+		// returns 'nchunks' if no more work is left
+		inline uint32	take	() {
+			std::unique_lock<std::mutex> guard(lock);
+			while (!stopped && next < nchunks && next >= merged + window) workcv.wait(guard);
+			if (stopped || next >= nchunks) return nchunks;
+			return next++;
+		}
+		inline void		done	(const uint32& idx) {
+			std::unique_lock<std::mutex> guard(lock);
+			chunks[idx].ready = true;
+			readycv.notify_all();
+		}
+		inline void		wait	(const uint32& idx) {
+			std::unique_lock<std::mutex> guard(lock);
+			while (!chunks[idx].ready) readycv.wait(guard);
+		}
+		inline void		consumed() {
+			std::unique_lock<std::mutex> guard(lock);
+			merged++;
+			workcv.notify_all();
+		}
+		inline void		stop	() {
+			std::unique_lock<std::mutex> guard(lock);
+			stopped = true;
+			workcv.notify_all();
+		}
+	};
+
+	// tokenize a chunk into literals delimited by zeros; no solver state is touched here
+	inline void tokenize(PARSECHUNK& chunk, const uint32& maxVar)
+	{
+		char* str = chunk.head, * end = chunk.tail;
+		uVec1D& lits = chunk.lits;
+		lits.clear();
+		lits.reserve(uint32((end - str) >> 2) + 1);
+		while (str < end) {
+			const char ch = *str;
+			if ((ch >= 9 && ch <= 13) || ch == 32) { str++; continue; }
+			if (ch == 'c') {
+				while (str < end && *str++ != '\n');
+				continue;
+			}
+			if (ch == '%' || ch == '\0') { chunk.eof = true; break; } // as the sequential parser
+			if (ch == 'p') { chunk.error = "found more than one header"; break; }
+			uint32 sign = 0;
+			if (ch == '-') sign = 1, str++;
+			else if (ch == '+') str++;
+			if (str == end || !isDigit(*str)) {
+				chunk.error = "expected a digit but ASCII(%d) is found";
+				chunk.errch = str == end ? 0 : *str;
+				break;
+			}
+			uint32 v = 0;
+			while (str < end && isDigit(*str)) {
+				v = v * 10 + (*str++ - '0');
+				if (v > maxVar) break;
+			}
+			if (v > maxVar) { chunk.error = "too many variables"; break; }
+			lits.push(v ? V2DEC(v, sign) : 0);
+		}
+	}
+
 	inline bool canAccess(const char* path, struct stat& st)
 	{
 		if (stat(path, &st)) return false;
@@ -77,6 +77,11 @@ bool ParaFROST::prop()
 				c.markDeleted(); // clause satisfied by an assigned unit
 			else {
 				const int size = c.size();
+				if (proof.lrat()) { // the identifier of 'c' still has 'f_assign'
+					proof.hintUnit(f_assign);
+					if (size == 1 && !UNASSIGNED(values[*c])) proof.hintUnit(*c);
+					proof.hintClause(*i);
+				}
 				if (!size) { learnEmpty(); return false; }
 				if (size == 1) {
 					const uint32 unit = *c;
@@ -84,6 +89,7 @@ bool ParaFROST::prop()
 					if (UNASSIGNED(values[unit])) enqueueUnit(unit);
 					else { learnEmpty(); return false; }
 				}
+				else if (proof.lrat()) proof.replaceClause(*i);
 			}
 		}
 		ot[f_assign].clear(true);
@@ -100,15 +106,18 @@ bool ParaFROST::prop()
 
 void ParaFROST::VE()
 {
+	PERFPHASE(PERF_VE);
 	if (opts.ve_en) {
 		PFLOG2(2, " Eliminating variables..");
 		bve();
+		stats.duplicates.resolved += dedup();
 		PFLREDALL(this, 2, "VE Reductions");
 	}
 }
 
 void ParaFROST::SUB()
 {
+	PERFPHASE(PERF_SUB);
 	if (opts.sub_en || opts.ve_plus_en) {
 		if (interrupted()) killSolver();
 		PFLOG2(2, " Eliminating (self)-subsumptions..");
@@ -130,6 +139,7 @@ void ParaFROST::SUB()
 
 void ParaFROST::BCE()
 {
+	PERFPHASE(PERF_BCE);
 	if (opts.bce_en) {
 		if (interrupted()) killSolver();
 		PFLOG2(2, " Eliminating blocked clauses..");
@@ -168,6 +178,7 @@ void ParaFROST::BCE()
 
 void ParaFROST::ERE()
 {
+	PERFPHASE(PERF_ERE);
 	if (!opts.ere_en) return;
 	if (interrupted()) killSolver();
 	PFLOG2(2, " Eliminating redundances..");
@@ -196,7 +207,9 @@ void ParaFROST::ERE()
 	PFLREDCL(this, 2, "ERE Reductions");
 }
 
-void ParaFROST::strengthen(SCLAUSE& c, const uint32& me)
+// 'c' is strengthened by removing 'me' using the clause 's'
+// (LRAT hints need 's' and the identifier of 'c' with 'me')
+void ParaFROST::strengthen(SCLAUSE& c, const uint32& me, const S_REF& s)
 {
 	uint32 sig = 0;
 	int n = 0;
@@ -215,19 +228,23 @@ void ParaFROST::strengthen(SCLAUSE& c, const uint32& me)
 		const uint32 unit = *c;
 		const LIT_ST val = sp->value[unit];
 		if (UNASSIGNED(val)) {
+			if (proof.lrat()) proof.hintClause(s), proof.hintClause(&c);
 			enqueueUnit(unit);
 			toblivion(ot[unit]); // safe to remove clauses of 'unit' in 'SUB'
 		}
 		else if (!val) { 
 			PFLOG2(2, "  SUB proved a contradiction");
+			if (proof.lrat()) proof.hintUnit(unit), proof.hintClause(s), proof.hintClause(&c);
 			learnEmpty();
 			killSolver();
 		}
 	}
 	else {
 		assert(c.isSorted());
-		if (opts.proof_en) 
-			proof.addResolvent(c);
+		if (opts.proof_en) {
+			if (proof.lrat()) proof.hintClause(s), proof.hintClause(&c);
+			proof.replaceClause(&c);
+		}
 		if (c.learnt()) 
 			bumpShrunken(c);
 	}
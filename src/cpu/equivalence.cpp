@@ -93,7 +93,9 @@ bool ParaFROST::decompose()
 							}
 							else {
 								PFLOG2(2, " Conflict as both %d and its negation in the same SCC", l2i(parent));
+								if (proof.lrat()) chainFailed(farent);
 								enqueueUnit(parent);
+								if (proof.lrat()) BCP(); // the conflict chains the empty clause
 								learnEmpty();
 							}
 						} while (cnfstate && NEQUAL(other, parent));
@@ -151,8 +153,15 @@ bool ParaFROST::decompose()
 	bool orgsucc = false, learntsucc = false;
 	if (substituted) {
 		assert(reduced.empty());
-		if (cnfstate) learntsucc = substitute(learnts, smallests);
-		if (cnfstate) orgsucc = substitute(orgs, smallests);
+		C_REF* sccs = NULL;
+		if (cnfstate && proof.lrat()) {
+			sccs = pfmalloc<C_REF>(dfs_size);
+			for (uint32 i = 0; i < dfs_size; i++) sccs[i] = NOREF;
+			spanSCCs(smallests, sccs);
+		}
+		if (cnfstate) learntsucc = substitute(learnts, smallests, sccs);
+		if (cnfstate) orgsucc = substitute(orgs, smallests, sccs);
+		if (sccs) free(sccs), sccs = NULL;
 		if (cnfstate && reduced.size()) {
 			forall_cnf(reduced, i) {
 				const C_REF r = *i;
@@ -193,7 +202,7 @@ bool ParaFROST::decompose()
 	return !cnfstate || (substituted && (orgsucc || learntsucc));
 }
 
-bool ParaFROST::substitute(BCNF& cnf, uint32* smallests)
+bool ParaFROST::substitute(BCNF& cnf, uint32* smallests, const C_REF* sccs)
 {
 	assert(UNSOLVED(cnfstate));
 	assert(learntC.empty());
@@ -235,6 +244,7 @@ bool ParaFROST::substitute(BCNF& cnf, uint32* smallests)
 			}
 			else if (val) satisfied = true;
 		}
+		if (!satisfied && proof.lrat()) chainSubstituted(ref, smallests, sccs);
 		if (satisfied) {
 			PFLCLAUSE(4, c, "  satisfied after substitution");
 			reduced.push(ref);
@@ -258,6 +268,7 @@ bool ParaFROST::substitute(BCNF& cnf, uint32* smallests)
 			removeClause(c, ref);
 			sp->learntLBD = c.lbd();
 			C_REF newref = newClause(learntC, c.learnt());
+			if (proof.lrat()) proof.bind(newref);
 			PFLCLAUSE(4, cm[newref], "  learnt after substitution");
 			assert(cnf[last] == newref);
 			cnf[last] = ref;
@@ -266,7 +277,8 @@ bool ParaFROST::substitute(BCNF& cnf, uint32* smallests)
 		else {
 			if (opts.proof_en) {
 				proof.addClause(learntC);
-				proof.deleteClause(c);
+				proof.deleteClause(ref, c);
+				if (proof.lrat()) proof.bind(ref);
 			}
 			const int csize = c.size();
 			assert(csize > 2);
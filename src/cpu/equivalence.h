@@ -42,6 +42,16 @@ inline uint32 substitute_single(const uint32& dx, SCLAUSE& org, const uint32& de
 	return 0;
 }
 
+inline S_REF find_molten(OL& list)
+{
+	forall_occurs(list, i) {
+		if ((*i)->original() && (*i)->molten()) return *i;
+	}
+	return NULL;
+}
+
+// substituted clauses are resolvents with the gate clause
+// of the other polarity, which LRAT needs for the hints
 inline bool substitute_single(const uint32& p, const uint32& def, OT& ot)
 {
 	CHECKLIT(def);
@@ -49,6 +59,10 @@ inline bool substitute_single(const uint32& p, const uint32& def, OT& ot)
 	const uint32 n = NEG(p), def_f = FLIP(def);
 	OL& poss = ot[p], & negs = ot[n];
 	const bool proofEN = pfrost->opts.proof_en;
+	PROOF& proof = pfrost->proof;
+	const S_REF posgate = proof.lrat() ? find_molten(poss) : NULL;
+	const S_REF neggate = proof.lrat() ? find_molten(negs) : NULL;
+	assert(!proof.lrat() || (posgate && neggate));
 	// substitute negatives 
 	for (int i = 0; i < negs.size(); i++) {
 		SCLAUSE& neg = *negs[i];
@@ -56,14 +70,20 @@ inline bool substitute_single(const uint32& p, const uint32& def, OT& ot)
 			neg.markDeleted();
 		else if (neg.original()) {
 			uint32 unit = substitute_single(n, neg, def_f);
+			if (proof.lrat()) proof.hintClause(posgate), proof.hintClause(negs[i]);
 			if (unit) {
 				const LIT_ST val = pfrost->litvalue(unit);
+				if (proof.lrat()) proof.replaceClause(negs[i]), proof.hintClause(negs[i]);
 				if (UNASSIGNED(val))
 					pfrost->enqueueUnit(unit);
-				else if (!val) return true;
+				else if (!val) {
+					if (proof.lrat()) proof.hintUnit(unit);
+					return true;
+				}
+				else if (proof.lrat()) proof.clearHints();
 			}
 			else if (proofEN)
-				pfrost->proof.addResolvent(neg);
+				proof.replaceClause(negs[i]);
 		}
 	}
 	// substitute positives
@@ -73,14 +93,20 @@ inline bool substitute_single(const uint32& p, const uint32& def, OT& ot)
 			pos.markDeleted();
 		else if (pos.original()) {
 			uint32 unit = substitute_single(p, pos, def);
+			if (proof.lrat()) proof.hintClause(neggate), proof.hintClause(poss[i]);
 			if (unit) {
 				const LIT_ST val = pfrost->litvalue(unit);
+				if (proof.lrat()) proof.replaceClause(poss[i]), proof.hintClause(poss[i]);
 				if (UNASSIGNED(val))
 					pfrost->enqueueUnit(unit);
-				else if (!val) return true;
+				else if (!val) {
+					if (proof.lrat()) proof.hintUnit(unit);
+					return true;
+				}
+				else if (proof.lrat()) proof.clearHints();
 			}
 			else if (proofEN)
-				pfrost->proof.addResolvent(pos);
+				proof.replaceClause(poss[i]);
 		}
 	}
 	return false; 
@@ -0,0 +1,111 @@
+/***********************************************************************[image.h]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#ifndef __IMAGE_
+#define __IMAGE_
+
+#include "vector.h"
+#include "definitions.h"
+
+namespace pFROST {
+
+	#define IMAGE_BLOCK	4096
+
+	enum IMAGE_MODE { IMAGE_NONE = 0, IMAGE_PLAIN = 1, IMAGE_COMPRESSED = 2 };
+
+	/*****************************************************/
+	/*  Usage: read-only image of the original clauses   */
+	/*         in input numbering, either as plain words */
+	/*         or as variable-length (LEB128) literals,  */
+	/*         each clause terminated by a zero          */
+	/*****************************************************/
+	class CNFIMAGE {
+		Vec<Byte, uint64> _bytes;
+		Vec<uint64, uint64> _blocks;
+		uint64 _clauses, _literals;
+		int _mode;
+
+		__forceinline void	put			(const uint32& lit) {
+			if (_mode == IMAGE_PLAIN) {
+				const Byte* bytes = (const Byte*)&lit;
+				for (int i = 0; i < 4; i++) _bytes.push(bytes[i]);
+				return;
+			}
+			uint32 x = lit;
+			while (x > 0x7F) {
+				_bytes.push(Byte(x | 0x80));
+				x >>= 7;
+			}
+			_bytes.push(Byte(x));
+		}
+
+	public:
+		CNFIMAGE() : _clauses(0), _literals(0), _mode(IMAGE_NONE) {}
+		~CNFIMAGE() { destroy(); }
+		__forceinline void		init		(const int& mode) { assert(empty()); _mode = mode; }
+		__forceinline bool		enabled		() const { return _mode != IMAGE_NONE; }
+		__forceinline bool		empty		() const { return !_clauses; }
+		__forceinline int		mode		() const { return _mode; }
+		__forceinline uint64	clauses		() const { return _clauses; }
+		__forceinline uint64	literals	() const { return _literals; }
+		__forceinline uint64	bytes		() const { return _bytes.size(); }
+		__forceinline uint64	blocks		() const { return _blocks.size(); }
+		// first byte of the block of 'IMAGE_BLOCK' clauses at 'b'
+		__forceinline uint64	block		(const uint64& b) const { return _blocks[b]; }
+		__forceinline const Byte* data		() const { return _bytes.size() ? &_bytes[0] : NULL; }
+		template <class SRC>
+		__forceinline void		push		(const SRC& clause) {
+			assert(enabled());
+			if (!(_clauses % IMAGE_BLOCK)) _blocks.push(_bytes.size());
+			for (int i = 0; i < clause.size(); i++) {
+				assert(clause[i] > 1);
+				put(clause[i]);
+			}
+			if (_mode == IMAGE_PLAIN) put(0);
+			else _bytes.push(0);
+			_literals += clause.size();
+			_clauses++;
+		}
+		// decodes the next literal at 'pos', returns 0 at the end of a clause
+		__forceinline uint32	next		(const Byte*& pos) const {
+			if (_mode == IMAGE_PLAIN) {
+				uint32 lit;
+				std::memcpy(&lit, pos, sizeof(uint32));
+				pos += sizeof(uint32);
+				return lit;
+			}
+			uint32 lit = 0;
+			int shift = 0;
+			Byte b;
+			do {
+				b = *pos++;
+				lit |= uint32(b & 0x7F) << shift;
+				shift += 7;
+			} while (b & 0x80);
+			return lit;
+		}
+		__forceinline void		shrinkCap	() { _bytes.shrinkCap(), _blocks.shrinkCap(); }
+		__forceinline void		destroy		() {
+			_bytes.clear(true), _blocks.clear(true);
+			_clauses = _literals = 0;
+		}
+	};
+
+}
+
+#endif
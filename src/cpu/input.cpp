@@ -59,7 +59,7 @@ namespace pFROST {
     {
         const char* arg = argv[1];
         int dashes = (arg[0] == '-') + (arg[1] == '-');
-        if ((dashes & 1) && arg[1] == 'h')
+        if ((dashes & 1) && arg[1] == 'h' && !arg[2])
             printUsage(argc, argv);
         else if ((dashes & 2) && hasstr(arg, "help")) {
             if (hasstr(arg, "more"))
@@ -76,7 +76,7 @@ namespace pFROST {
                 int dashes = (arg[0] == '-') + (arg[1] == '-');
                 if (!dashes) 
                     PFLOGE("unknown input \"%s\". Use '-h or --help' for help.", argv[i]);
-                else if ((dashes & 1) && arg[1] == 'h')
+                else if ((dashes & 1) && arg[1] == 'h' && !arg[2])
                     printUsage(argc, argv);
                 else if ((dashes & 2) && hasstr(arg, "help")) {
                     if (hasstr(arg, "more")) 
@@ -0,0 +1,208 @@
+/***********************************************************************[lists.h]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#ifndef __LISTS_
+#define __LISTS_
+
+#include "vector.h"
+#include <climits>
+
+namespace pFROST {
+
+	/*****************************************************/
+	/*  Usage: slim vector for per-literal lists with a  */
+	/*         (pointer, size, capacity) header that can */
+	/*         borrow its storage from a LISTS arena     */
+	/*  Dependency:  none                                */
+	/*****************************************************/
+	#define LIST_BORROWED	INT_MIN
+	#define LIST_CAPACITY	INT_MAX
+
+	template<class T>
+	class SVec {
+		T* _mem;
+		int sz, cap; // sign bit of 'cap' marks storage owned by an arena
+		bool check(const int& idx) const {
+			if (idx < 0 || idx >= sz) {
+				SETCOLOR(CERROR, stderr);
+				std::cerr << "ERROR - index is out of list boundary (type: " << typeid(T).name() <<
+					", index: " << (long long)idx << ", size:" << (long long)sz << ")" << std::endl;
+				SETCOLOR(CNORMAL, stderr);
+				return false;
+			}
+			return true;
+		}
+		__forceinline void		release		() { if (_mem != NULL && !borrowed()) std::free(_mem); }
+	public:
+		__forceinline			~SVec		() { clear(true); }
+		__forceinline			SVec		() : _mem(NULL), sz(0), cap(0) { }
+		__forceinline SVec<T>&	operator=	(SVec<T>& rhs) { return *this; }
+		__forceinline const T&	operator[]	(const int& index) const { assert(check(index)); return _mem[index]; }
+		__forceinline T&		operator[]	(const int& index) { assert(check(index)); return _mem[index]; }
+		__forceinline const T&	back		() const { assert(sz); return _mem[sz - 1]; }
+		__forceinline T&		back		() { assert(sz); return _mem[sz - 1]; }
+		__forceinline			operator T* () { return _mem; }
+		__forceinline T*		data		() { return _mem; }
+		__forceinline T*		end			() { return _mem + sz; }
+		__forceinline bool		empty		() const { return !sz; }
+		__forceinline bool		borrowed	() const { return cap < 0; }
+		__forceinline int		size		() const { return sz; }
+		__forceinline int		capacity	() const { return cap & LIST_CAPACITY; }
+		__forceinline void		pop			() { assert(sz > 0); _mem[--sz].~T(); }
+		__forceinline void		insert		(const T& val) { assert(capacity() > sz);  _mem[sz++] = val; }
+		__forceinline void		push		(const T& val) { if (sz == capacity()) reserve(sz + 1); new (_mem + sz) T(val); sz++; }
+		__forceinline void		resize		(const int& n) {
+			if (n == sz) return;
+			if (n < sz) shrink(sz - n);
+			else expand(n);
+		}
+		__forceinline void		shrink		(const int& n) {
+			assert(n <= sz);
+			for (int i = 0; i < n; i++) _mem[--sz].~T();
+		}
+		__forceinline void		expand		(const int& size) {
+			if (sz >= size) return;
+			reserve(size);
+			for (int i = sz; i < size; i++) new (&_mem[i]) T();
+			sz = size;
+		}
+		__forceinline void		reserve		(const int& min_cap) {
+			int newcap = capacity();
+			if (newcap >= min_cap) return;
+			newcap = (newcap > (LIST_CAPACITY - newcap)) ? min_cap : (newcap << 1);
+			if (newcap < min_cap) newcap = min_cap;
+			if (borrowed()) { // leave the arena for good
+				T* mem = pfmalloc<T>(newcap);
+				if (sz) std::memcpy(mem, _mem, sz * sizeof(T));
+				_mem = mem;
+			}
+			else pfralloc(_mem, sizeof(T) * newcap);
+			cap = newcap;
+		}
+		__forceinline void		shrinkCap	() {
+			if (!sz) { clear(true); return; }
+			else if (!borrowed() && cap > sz) {
+				pfshrinkAlloc(_mem, sizeof(T) * sz);
+				cap = sz;
+			}
+		}
+		__forceinline void		borrow		(T* mem, const int& _cap) {
+			assert(mem != NULL);
+			assert(_cap >= sz && _cap <= LIST_CAPACITY);
+			release();
+			_mem = mem, cap = _cap | LIST_BORROWED;
+		}
+		__forceinline void		copyFrom	(SVec<T>& copy) {
+			resize(copy.size());
+			std::memcpy(_mem, copy, sz * sizeof(T));
+		}
+		__forceinline void		migrateTo	(SVec<T>& dest) {
+			dest.release();
+			dest._mem = _mem, dest.sz = sz, dest.cap = cap;
+			_mem = NULL, sz = 0, cap = 0;
+		}
+		__forceinline void		clear		(const bool& _free = false) {
+			if (_mem != NULL) {
+				for (int i = 0; i < sz; i++) _mem[i].~T();
+				sz = 0;
+				if (_free) { release(); _mem = NULL; cap = 0; }
+			}
+		}
+	};
+
+	/*****************************************************/
+	/*  Usage: table of per-literal lists compacted in   */
+	/*         bulk into one arena to avoid a heap block */
+	/*         per list (lists that outgrow their arena  */
+	/*         slot move back to the heap until the next */
+	/*         compaction); an exact layout packs lists  */
+	/*         back to back like a CSR table             */
+	/*  Dependency:  Vec, SVec                           */
+	/*****************************************************/
+	template<class T>
+	class LISTS : public Vec< SVec<T> > {
+		typedef Vec< SVec<T> > TABLE;
+		T* _arena;
+		size_t _arenasz, _reclaimed, _compactions;
+		inline static int	slot		(const int& size, const bool& exact) { return exact ? size : size + (size >> 2) + 2; }
+		inline void			dealloc		() { if (_arena != NULL) std::free(_arena), _arena = NULL; _arenasz = 0; }
+	public:
+							~LISTS		() { TABLE::clear(true), dealloc(); }
+							LISTS		() : _arena(NULL), _arenasz(0), _reclaimed(0), _compactions(0) { }
+		inline void			clear		(const bool& _free = false) { TABLE::clear(_free), dealloc(); }
+		inline size_t		arena		() const { return _arenasz * sizeof(T); }
+		inline size_t		reclaimed	() const { return _reclaimed; }
+		inline size_t		compactions	() const { return _compactions; }
+		inline void			layout		(const uint32* sizes, const bool& exact = false) {
+			SVec<T>* lists = TABLE::data();
+			const uint32 nlists = TABLE::size();
+			size_t before = arena(), needed = 0;
+			for (uint32 i = 0; i < nlists; i++) {
+				SVec<T>& list = lists[i];
+				if (!list.borrowed()) before += list.capacity() * sizeof(T);
+				list.clear(true);
+				if (sizes[i]) needed += slot(sizes[i], exact);
+			}
+			dealloc();
+			if (!needed) return;
+			T* next = _arena = pfmalloc<T>(needed);
+			pfadvise(_arena, needed * sizeof(T));
+			_arenasz = needed;
+			for (uint32 i = 0; i < nlists; i++) {
+				if (!sizes[i]) continue;
+				const int cap = slot(sizes[i], exact);
+				lists[i].borrow(next, cap);
+				next += cap;
+			}
+			assert(next == _arena + needed);
+			const size_t after = needed * sizeof(T);
+			if (before > after) _reclaimed += before - after;
+			_compactions++;
+		}
+		inline void			compact		() {
+			SVec<T>* lists = TABLE::data();
+			const uint32 nlists = TABLE::size();
+			size_t before = arena(), needed = 0;
+			for (uint32 i = 0; i < nlists; i++) {
+				const SVec<T>& list = lists[i];
+				if (!list.borrowed()) before += list.capacity() * sizeof(T);
+				if (list.size()) needed += slot(list.size(), false);
+			}
+			T* arena = needed ? pfmalloc<T>(needed) : NULL;
+			pfadvise(arena, needed * sizeof(T));
+			T* next = arena;
+			for (uint32 i = 0; i < nlists; i++) {
+				SVec<T>& list = lists[i];
+				const int size = list.size();
+				if (!size) { list.clear(true); continue; }
+				std::memcpy(next, list.data(), size * sizeof(T));
+				list.borrow(next, slot(size, false));
+				next += slot(size, false);
+			}
+			assert(next == arena + needed);
+			dealloc();
+			_arena = arena, _arenasz = needed;
+			const size_t after = needed * sizeof(T);
+			if (before > after) _reclaimed += before - after;
+			_compactions++;
+		}
+	};
+
+}
+
+#endif
@@ -0,0 +1,223 @@
+/***********************************************************************[lrat.cpp]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#include "solve.h"
+using namespace pFROST;
+
+#define CHAIN_POST 0x80000000U
+
+inline void ParaFROST::chainReason(const C_REF& ref, const uint32& implied, const uint64& marker)
+{
+	const uint64* board = sp->board;
+	const LIT_ST* marks = sp->marks;
+	CLAUSE& c = cm[ref];
+	forall_clause(c, k) {
+		const uint32 lit = *k, v = ABS(lit);
+		CHECKLIT(lit);
+		if (v == implied || board[v] == marker) continue;
+		assert(isFalse(lit));
+		if (marks[v] == SIGN(lit)) continue;
+		if (!l2dl(lit)) {
+			sp->board[v] = marker;
+			proof.hintUnit(lit);
+		}
+		else chained.push(v);
+	}
+}
+
+// Collects the LRAT hints deriving the marked literals from
+// the falsified clause 'ref' (all of it but the variable
+// 'implied' if given). Reasons are visited depth-first
+// and emitted in post-order so that every hint is unit (or
+// falsified for the last one) when it is checked. Literals
+// assigned on the top level are replaced by their unit ids
+void ParaFROST::chainConflict(const C_REF& ref, const uint32& implied)
+{
+	assert(proof.lrat());
+	assert(REASON(ref));
+	assert(chained.empty());
+	const uint64 marker = ++stats.marker;
+	uint64* board = sp->board;
+	const SOURCES sources = sp->source;
+	chainReason(ref, implied, marker);
+	while (chained.size()) {
+		const uint32 v = chained.back();
+		chained.pop();
+		if (v & CHAIN_POST) {
+			proof.hintClause(sources[v & ~CHAIN_POST]);
+			continue;
+		}
+		CHECKVAR(v);
+		if (board[v] == marker) continue;
+		board[v] = marker;
+		assert(REASON(sources[v]));
+		chained.push(v | CHAIN_POST);
+		chainReason(sources[v], v, marker);
+	}
+	proof.hintClause(ref);
+}
+
+void ParaFROST::chainUnit(const uint32& lit, const C_REF& src)
+{
+	assert(proof.lrat());
+	CHECKLIT(lit);
+	CLAUSE& c = cm[src];
+	forall_clause(c, k) {
+		const uint32 other = *k;
+		if (NEQUAL(other, lit)) {
+			assert(isFalse(other));
+			assert(!l2dl(other));
+			proof.hintUnit(other);
+		}
+	}
+	proof.hintClause(src);
+}
+
+// literals removed by binary minimization are kept in 'minimized'
+// and their binaries are already hinted before the conflict chain
+void ParaFROST::chainLearnt()
+{
+	assert(proof.lrat());
+	assert(conflict != NOREF);
+	forall_clause(learntC, k) { markLit(*k); }
+	forall_vector(uint32, minimized, k) { markLit(*k); }
+	chainConflict(conflict);
+	forall_clause(learntC, k) { unmarkLit(*k); }
+	forall_vector(uint32, minimized, k) { unmarkLit(*k); }
+	minimized.clear();
+}
+
+void ParaFROST::chainStrengthened(CLAUSE& c, const uint32& self)
+{
+	assert(proof.lrat());
+	assert(conflict != NOREF);
+	forall_clause(c, k) {
+		const uint32 lit = *k;
+		if (NEQUAL(lit, self) && l2dl(lit)) markLit(lit);
+	}
+	chainConflict(conflict);
+	forall_clause(c, k) { unmarkLit(*k); }
+}
+
+// the hyper binary resolvent (dom imp) of 'ref' is implied as the
+// other literals of 'ref' are all implied by the negation of 'dom'
+void ParaFROST::chainHyper(const C_REF& ref, const uint32& dom, const uint32& imp)
+{
+	assert(proof.lrat());
+	assert(isFalse(dom));
+	markLit(dom);
+	chainConflict(ref, ABS(imp));
+	unmarkLit(dom);
+}
+
+// Derives the negation of 'lit' by propagating it on a new
+// decision level. The hints are left for the unit which the
+// caller adds on the top level if 'lit' failed
+bool ParaFROST::chainFailed(const uint32& lit)
+{
+	assert(proof.lrat());
+	assert(!DL());
+	assert(conflict == NOREF);
+	CHECKLIT(lit);
+	enqueueDecision(lit);
+	const bool failed = BCP();
+	if (failed) {
+		const uint32 unit = FLIP(lit);
+		markLit(unit);
+		chainConflict(conflict);
+		unmarkLit(unit);
+		conflict = NOREF;
+	}
+	backtrack();
+	return failed;
+}
+
+// Spans every SCC of the binary implication graph by a tree
+// rooted at its representative. 'sccs' keeps for each member
+// the binary implying it from its parent in the tree
+void ParaFROST::spanSCCs(const uint32* smallests, C_REF* sccs)
+{
+	assert(proof.lrat());
+	assert(chained.empty());
+	uVec1D& queue = chained;
+	forall_literal(root) {
+		if (NEQUAL(smallests[root], root)) continue;
+		queue.push(root);
+		for (uint32 q = 0; q < queue.size(); q++) {
+			WL& ws = wt[queue[q]];
+			forall_watches(ws, i) {
+				const WATCH w = *i;
+				if (!w.binary()) continue;
+				const uint32 child = w.imp;
+				CHECKLIT(child);
+				if (child == root || NEQUAL(smallests[child], root)) continue;
+				if (sccs[child] != NOREF || cm.deleted(w.ref)) continue;
+				sccs[child] = w.ref;
+				queue.push(child);
+			}
+		}
+		queue.clear();
+	}
+}
+
+// Collects the hints deriving the substitution of clause 'ref'. The
+// negation of a substituted literal follows from the negation of its
+// representative along the tree spanning their SCC (see 'spanSCCs')
+void ParaFROST::chainSubstituted(const C_REF& ref, const uint32* smallests, const C_REF* sccs)
+{
+	assert(proof.lrat());
+	assert(chained.empty());
+	const uint64 marker = ++stats.marker;
+	uint64* board = sp->board;
+	CLAUSE& c = cm[ref];
+	forall_clause(c, k) {
+		const uint32 lit = *k;
+		CHECKLIT(lit);
+		if (!unassigned(lit)) {
+			assert(isFalse(lit));
+			assert(!l2dl(lit));
+			board[ABS(lit)] = marker;
+			proof.hintUnit(lit);
+			continue;
+		}
+		const uint32 rep = smallests[lit];
+		if (rep == lit) continue;
+		CHECKLIT(rep);
+		if (!unassigned(rep) && NEQUAL(board[ABS(rep)], marker)) {
+			assert(isFalse(rep));
+			board[ABS(rep)] = marker;
+			proof.hintUnit(rep);
+		}
+		const uint32 root = FLIP(rep);
+		assert(smallests[FLIP(lit)] == root);
+		uint32 node = FLIP(lit);
+		while (NEQUAL(node, root) && NEQUAL(board[ABS(node)], marker)) {
+			board[ABS(node)] = marker;
+			chained.push(node);
+			assert(sccs[node] != NOREF);
+			const CLAUSE& b = cm[sccs[node]];
+			assert(b.binary());
+			node = FLIP(b[0] ^ b[1] ^ node);
+		}
+		while (chained.size()) {
+			proof.hintClause(sccs[chained.back()]);
+			chained.pop();
+		}
+	}
+	proof.hintClause(ref);
+}
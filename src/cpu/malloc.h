@@ -21,8 +21,12 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "datatypes.h"
 #include "logging.h"
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
 
 namespace pFROST {
 
@@ -71,6 +75,42 @@ namespace pFROST {
 #if defined(__linux__) || defined(__CYGWIN__)
 #pragma GCC diagnostic pop
 #endif
+
+	/*****************************************************/
+	/*  Usage: page policy of the large solver arenas    */
+	/*         (clause memory, SP block, list arenas and */
+	/*         the simplifier pool)                      */
+	/*  Dependency:  none                                */
+	/*****************************************************/
+	#define HUGEPAGE	0x00200000
+
+	struct PAGEPOLICY {
+		size_t	advised;
+		bool	huge;
+		PAGEPOLICY() : advised(0), huge(false) { }
+	};
+
+	inline PAGEPOLICY& pagepolicy() { static PAGEPOLICY policy; return policy; }
+
+	// ask for transparent huge pages on the 2 MB aligned
+	// part of an arena before it is first touched
+	inline void pfadvise(void* mem, const size_t& bytes) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+		PAGEPOLICY& policy = pagepolicy();
+		if (!policy.huge || mem == NULL || bytes < HUGEPAGE) return;
+		const uintptr_t first = (uintptr_t(mem) + HUGEPAGE - 1) & ~uintptr_t(HUGEPAGE - 1);
+		const uintptr_t last = (uintptr_t(mem) + bytes) & ~uintptr_t(HUGEPAGE - 1);
+		if (last <= first) return;
+		if (!madvise((void*)first, last - first, MADV_HUGEPAGE))
+			policy.advised += last - first;
+#endif
+	}
+
+	template <class T>
+	void pfarena(T*& mem, size_t bytes) {
+		pfralloc(mem, bytes);
+		pfadvise(mem, bytes);
+	}
 }
 
 #endif
\ No newline at end of file
@@ -134,6 +134,7 @@ inline void ParaFROST::MDMAssume(const LIT_ST* values, LIT_ST* frozen, uint32*&
 void ParaFROST::MDMInit()
 {
 	if (!last.mdm.rounds) return;
+	if (!opts.mdmassume_en && assumptions.size()) return; // assumptions are decided first
 
 	assert(inf.unassigned);
 	assert(sp->propagated == trail.size());
@@ -42,7 +42,7 @@ namespace pFROST {
     protected:
         bool check(const S& d) const {
             if (d >= sz) {
-                PFLOGEN("memory index (%zd) violates memory boundary (%zd)", d, sz);
+                PFLOGEN("memory index (%zd) violates memory boundary (%zd)", size_t(d), size_t(sz));
                 return false;
             }
             return true;
@@ -60,7 +60,7 @@ namespace pFROST {
         }
         bool checkSize(const S& newSz) const {
             if (sz != 0 && newSz <= sz) {
-                PFLOGEN("size overflow during memory allocation: (new = %zd, old = %zd)", newSz, sz);
+                PFLOGEN("size overflow during memory allocation: (new = %zd, old = %zd)", size_t(newSz), size_t(sz));
                 return false;
             }
             return true;
@@ -90,18 +90,18 @@ namespace pFROST {
             if (!init_cap) return;
             assert(_bucket);
             if (init_cap > maxCap) {
-                PFLOGEN("initial size exceeds maximum memory size: (max = %zd, size = %zd)", maxCap, init_cap);
+                PFLOGEN("initial size exceeds maximum memory size: (max = %zd, size = %zd)", size_t(maxCap), size_t(init_cap));
                 throw MEMOUTEXCEPTION();
             }
             cap = init_cap;
-            pfralloc(_mem, _bucket * cap);
+            pfarena(_mem, _bucket * cap);
         }
         inline void     reserve     (const S& min_cap) {
             if (cap >= min_cap) return;
             cap = (cap > (maxCap - cap)) ? min_cap : (cap << 1);
             if (cap < min_cap) cap = min_cap;
             assert(_bucket);
-            pfralloc(_mem, _bucket * cap);
+            pfarena(_mem, _bucket * cap);
         }
         inline S        alloc       (const S& size) {
             assert(size > 0);
@@ -112,6 +112,22 @@ namespace pFROST {
             assert(sz > 0);
             return oldSz;
         }
+        inline void     shrinkTo    (const S& newSz) { shrinkTo(newSz, newSz); }
+        // keep 'newSz' units with a capacity of exactly 'newCap'
+        inline void     shrinkTo    (const S& newSz, const S& newCap) {
+            assert(newSz <= sz);
+            assert(newSz <= newCap);
+            sz = newSz, _junk = 0;
+            if (!newCap) { dealloc(); return; }
+            if (cap > newCap) {
+                cap = newCap;
+                pfralloc(_mem, _bucket * cap);
+            }
+            else if (cap < newCap) {
+                cap = newCap;
+                pfarena(_mem, _bucket * cap);
+            }
+        }
         inline void     migrateTo   (SMM& newBlock) {
             if (newBlock._mem != NULL) std::free(newBlock._mem);
             newBlock._mem = _mem, newBlock.sz = sz, newBlock.cap = cap, newBlock._junk = _junk;
@@ -121,62 +137,188 @@ namespace pFROST {
 
 
     /*****************************************************/
-    /*  Usage: memory manager for CNF clauses            */
-    /*  Dependency:  CLAUSE, SMM                         */
+    /*  Usage: deletion bitmap of the clause arena with  */
+    /*         one bit per literal-sized arena word      */
+    /*  Dependency:  Vec                                 */
     /*****************************************************/
-    typedef SMM<Byte, C_REF> CTYPE;
-    class CMM : public CTYPE
+    #define STENCIL_WORD  6 // 64 bits per word
+
+    class STENCIL
     {
+        Vec<uint64, C_REF> _bits;
+        inline static C_REF     word        (const C_REF& r) { return r >> STENCIL_WORD; }
+        inline static uint64    mask        (const C_REF& r) { return 1ULL << (r & 63); }
     public:
+        inline bool             operator[]  (const C_REF& r) const { return _bits[word(r)] & mask(r); }
+        inline void             set         (const C_REF& r) { _bits[word(r)] |= mask(r); }
+        inline void             expand      (const C_REF& words) { if (words) _bits.expand(word(words - 1) + 1, 0); }
+        inline void             resize      (const C_REF& words) { _bits.clear(), expand(words); }
+        inline size_t           capacity    () const { return _bits.capacity() * sizeof(uint64); }
+        inline void             migrateTo   (STENCIL& dest) { _bits.migrateTo(dest._bits); }
+        inline void             clear       (const bool& _free = false) { _bits.clear(_free); }
+    };
 
-        Vec<bool, C_REF> stencil;
+    /*****************************************************/
+    /*  Usage: memory manager for CNF clauses split into */
+    /*         an original and a learnt generation, each */
+    /*         in its own arena so that one can be       */
+    /*         collected without copying the other; the  */
+    /*         generation is tagged in the highest bit   */
+    /*         of the reference (offsets in literal-     */
+    /*         sized words, 64-bit unless built with     */
+    /*         COMPACTREF, which limits each generation  */
+    /*         to 4 GB); learnts promoted to originals   */
+    /*         move to the original generation when the  */
+    /*         learnt one is collected; with LRAT proofs */
+    /*         each clause is preceded by its 64-bit     */
+    /*         identifier, which moves with the clause   */
+    /*  Dependency:  CLAUSE, SMM, STENCIL                */
+    /*****************************************************/
+    #define GENERATIONS 2
+    #define LEARNTGEN   (MAXREF ^ (MAXREF >> 1)) // highest bit a watch can hold
 
-        CMM() { 
-            assert(CTYPE::bucket() == 1);
+    typedef SMM<uint32, C_REF> CTYPE;
+    class CMM
+    {
+        CTYPE   _arena[GENERATIONS];
+        STENCIL _stencil[GENERATIONS];
+        bool    _moving[GENERATIONS]; // generations received in a collection
+        C_REF   _idwords; // 'IDWORDS' if clauses carry LRAT identifiers
+        inline static int       gen             (const C_REF& r) { return (r & LEARNTGEN) ? 1 : 0; }
+        inline static C_REF     offset          (const C_REF& r) { return r & ~C_REF(LEARNTGEN); }
+        inline static C_REF     tag             (const int& g, const C_REF& off) { return g ? (off | LEARNTGEN) : off; }
+        inline void             overflow        (const int& g, const size_t& cWords) {
+            if (_arena[g].size() > (LEARNTGEN - 1) - cWords) {
+                PFLOGEN("clause generation exceeds %zd GB (rebuild without COMPACTREF for larger arenas)", size_t(LEARNTGEN / GBYTE) * hc_isize);
+                throw MEMOUTEXCEPTION();
+            }
+        }
+        inline C_REF            place           (const int& g, const int& size) {
+            const size_t cWords = footprint(size);
+            overflow(g, cWords);
+            const C_REF off = _arena[g].alloc(C_REF(cWords)) + _idwords;
+            _stencil[g].expand(off + 1);
+            return tag(g, off);
+        }
+    public:
+        CMM() {
+            assert(_arena[0].bucket() == hc_isize);
             assert(hc_isize == sizeof(uint32));
-            assert(hc_csize == sizeof(CLAUSE)); 
+            assert(hc_csize == sizeof(CLAUSE));
+            assert(!(hc_csize % hc_isize));
+            _moving[0] = _moving[1] = false;
+            _idwords = 0;
         }
-        explicit				CMM             (const C_REF& init_cap) : CTYPE(init_cap), stencil(init_cap, 0) { assert(CTYPE::bucket() == 1); }
-        inline void				init            (const C_REF& init_cap) { CTYPE::init(init_cap), stencil.resize(init_cap, 0); }
-        inline		 CLAUSE&    operator[]		(const C_REF& r) { return (CLAUSE&)CTYPE::operator[](r); }
-        inline const CLAUSE&    operator[]		(const C_REF& r) const { return (CLAUSE&)CTYPE::operator[](r); }
+        inline		 CLAUSE&    operator[]		(const C_REF& r) { return (CLAUSE&)_arena[gen(r)][offset(r)]; }
+        inline const CLAUSE&    operator[]		(const C_REF& r) const { return (CLAUSE&)_arena[gen(r)][offset(r)]; }
         inline		 CLAUSE*    clause          (const C_REF& r) { return (CLAUSE*)address(r); }
         inline const CLAUSE*    clause          (const C_REF& r) const { return (CLAUSE*)address(r); }
-        inline bool				deleted         (const C_REF& r) const { assert(check(r)); return stencil[r]; }
-        inline void				collectClause   (const C_REF& r, const int& size) { CTYPE::collect(bytes(size)); assert(check(r)); stencil[r] = true; }
-        inline void				collectLiterals (const int& size) { CTYPE::collect(size * hc_isize); }
-        inline void				migrateTo       (CMM& dest) {
-            CTYPE::migrateTo(dest);
-            stencil.migrateTo(dest.stencil);
+        inline		 uint32*    address         (const C_REF& r) { return _arena[gen(r)].address(offset(r)); }
+        inline const uint32*    address         (const C_REF& r) const { return _arena[gen(r)].address(offset(r)); }
+        inline static bool      learntGen       (const C_REF& r) { return gen(r); }
+        inline static size_t    words           (const int& size) {
+            assert(size > 1);
+            return (hc_csize / hc_isize + (size_t(size) - 2));
+        }
+        // words taken by a clause including its identifier
+        inline size_t           footprint       (const int& size) const { return words(size) + _idwords; }
+        inline C_REF            idwords         () const { return _idwords; }
+        inline void             identify        () { assert(!size()); _idwords = IDWORDS; }
+        inline uint64           id              (const C_REF& r) const {
+            assert(_idwords);
+            const uint32* w = address(r) - IDWORDS;
+            return uint64(w[0]) | (uint64(w[1]) << 32);
+        }
+        inline void             setID           (const C_REF& r, const uint64& i) {
+            assert(_idwords);
+            assert(i);
+            uint32* w = address(r) - IDWORDS;
+            w[0] = uint32(i), w[1] = uint32(i >> 32);
+        }
+        inline bool             valid           (const C_REF& r) const { return r != NOREF && offset(r) < _arena[gen(r)].size(); }
+        inline bool				deleted         (const C_REF& r) const { assert(valid(r)); return _stencil[gen(r)][offset(r)]; }
+        inline bool             moving          (const C_REF& r) const { return _moving[gen(r)]; }
+        inline bool             moving          (const int& g) const { return _moving[g]; }
+        inline size_t			bucket          () const { return hc_isize; }
+        inline C_REF            size            (const int& g) const { return _arena[g].size(); }
+        inline C_REF            garbage         (const int& g) const { return _arena[g].garbage(); }
+        inline C_REF            live            (const int& g) const { return size(g) - garbage(g); }
+        inline C_REF            size            () const { return size(0) + size(1); }
+        inline C_REF            garbage         () const { return garbage(0) + garbage(1); }
+        inline bool             collectable     (const int& g, const double& perc) const { return garbage(g) > size(g) * perc; }
+        inline void             init            (const C_REF& orgcap, const C_REF& learntcap = 0) {
+            _arena[0].init(orgcap), _stencil[0].resize(orgcap);
+            _arena[1].init(learntcap), _stencil[1].resize(learntcap);
+        }
+        inline void				collectClause   (const C_REF& r, const int& size) {
+            assert(valid(r));
+            _arena[gen(r)].collect(C_REF(footprint(size)));
+            _stencil[gen(r)].set(offset(r));
+        }
+        inline void				collectLiterals (const CLAUSE& c, const int& size) {
+            const uint32* lits = (const uint32*)&c;
+            const int g = _arena[1].size() && lits >= _arena[1].address(0) && lits < _arena[1].address(0) + _arena[1].size();
+            _arena[g].collect(C_REF(size));
         }
         template <class SRC>
-        inline C_REF			alloc           (const SRC& src) {
+        inline C_REF			alloc           (const SRC& src, const bool& learnt) {
             assert(src.size() > 1);
-            size_t cBytes = bytes(src.size());
-            C_REF r = CTYPE::alloc(cBytes);
+            const C_REF r = place(learnt, src.size());
             new (clause(r)) CLAUSE(src);
-            assert(clause(r)->capacity() == cBytes);
+            assert(clause(r)->capacity() == words(src.size()) * hc_isize);
             assert(src.size() == clause(r)->size());
-            stencil.expand(r + 1, 0);
             return r;
         }
-        inline C_REF			alloc           (const int& size) {
+        inline C_REF			alloc           (const int& size, const bool& learnt) {
             assert(size > 1);
-            size_t cBytes = bytes(size);
-            C_REF r = CTYPE::alloc(cBytes);
+            const C_REF r = place(learnt, size);
             new (clause(r)) CLAUSE(size);
-            assert(clause(r)->capacity() == cBytes);
+            assert(clause(r)->capacity() == words(size) * hc_isize);
             assert(size == clause(r)->size());
-            stencil.expand(r + 1, 0);
             return r;
         }
-        inline size_t			bytes           (const int& size) {
-            assert(size > 1);
-            return (hc_csize + (size_t(size) - 2) * hc_isize);
+        // become the target of collecting the generations 'gens' of 'from'
+        inline void             target          (const CMM& from, const bool* gens) {
+            _idwords = from._idwords;
+            for (int g = 0; g < GENERATIONS; g++) {
+                assert(!_arena[g].size());
+                _moving[g] = gens[g];
+                if (gens[g]) _arena[g].init(from.live(g)), _stencil[g].resize(from.live(g));
+            }
+        }
+        // take over the generations of 'from' that were not collected
+        inline void             adopt           (CMM& from) {
+            for (int g = 0; g < GENERATIONS; g++) {
+                if (!_moving[g]) {
+                    from._arena[g].migrateTo(_arena[g]);
+                    from._stencil[g].migrateTo(_stencil[g]);
+                }
+                _moving[g] = false;
+            }
+        }
+        // 'reserved' >= 'newSz' leaves exact room for clauses appended afterwards
+        inline void             slid            (const int& g, const C_REF& newSz, const C_REF& reserved) {
+            _arena[g].shrinkTo(newSz, reserved), _stencil[g].resize(newSz);
+        }
+        inline void				migrateTo       (CMM& dest) {
+            for (int g = 0; g < GENERATIONS; g++) {
+                _arena[g].migrateTo(dest._arena[g]);
+                _stencil[g].migrateTo(dest._stencil[g]);
+                dest._moving[g] = _moving[g], _moving[g] = false;
+            }
+        }
+        inline void				restore         (const int& g, const uint32* src, const C_REF& size) {
+            assert(!_arena[g].size());
+            if (!size) return;
+            _arena[g].init(size), _stencil[g].resize(size);
+            _arena[g].alloc(size);
+            std::memcpy(_arena[g].address(0), src, size * hc_isize);
+        }
+        inline void				destroy         () {
+            for (int g = 0; g < GENERATIONS; g++)
+                _arena[g].dealloc(), _stencil[g].clear(true);
         }
-        inline void				destroy         () { dealloc(), stencil.clear(true); }
     };
-
 }
 
 #endif
\ No newline at end of file
@@ -49,14 +49,19 @@ void ParaFROST::minimizebin()
 	WL& ws = wt[uip];
 	int nLitsRem = 0;
 	const int size = learntC.size() - 1;
+	assert(minimized.empty());
 	forall_watches(ws, i) {
 		const WATCH w = *i;
 		if (w.binary()) {
 			const uint32 other = w.imp, v = ABS(other);
-			if (sp->board[v] == marker && isTrue(other)) {
+			if (sp->board[v] == marker && isTrue(other) && !cm.deleted(w.ref)) {
 				sp->board[v] = unmarker;
 				sp->seen[v] = 0; // see no evil!
 				nLitsRem++;
+				if (proof.lrat()) { // chained with the learnt clause
+					proof.hintClause(w.ref);
+					minimized.push(FLIP(other));
+				}
 			}
 		}
 		if (nLitsRem == size) break; // bail out early
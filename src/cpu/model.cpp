@@ -18,6 +18,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "model.h"
 #include "dimacs.h"
+#include <atomic>
 
 using namespace pFROST;
 
@@ -260,6 +261,89 @@ bool MODEL::verify(char*& str)
 	return clauseSAT;
 }
 
+void MODEL::verifyImage(const int& nthreads)
+{
+	if (!extended) {
+		PFLOGEN("model is not extended yet");
+		return;
+	}
+	assert(image.enabled());
+	PFLOG2(1, " ");
+	PFLOG2(1, " Verifying model on input image..");
+	PFLOG2(1, "  checking %s image (size: %s%lld KB%s) using %s%d thread(s)%s",
+		image.mode() == IMAGE_COMPRESSED ? "compressed" : "plain",
+		CREPORTVAL, image.bytes() / KBYTE, CNORMAL, CREPORTVAL, nthreads, CNORMAL);
+	TIMER timer;
+	timer.start();
+	const uint64 nclauses = image.clauses(), nblocks = image.blocks();
+	std::atomic<uint64> nextblock(0), failed(UINT64_MAX);
+	// each worker checks whole blocks; the first falsified clause wins
+	auto worker = [&]() {
+		uint64 b;
+		while ((b = nextblock++) < nblocks) {
+			const Byte* pos = image.data() + image.block(b);
+			uint64 c = b * IMAGE_BLOCK;
+			const uint64 end = std::min(c + IMAGE_BLOCK, nclauses);
+			for (; c < end && c < failed; c++) {
+				bool clauseSAT = false;
+				uint32 lit;
+				while ((lit = image.next(pos))) {
+					if (!clauseSAT && ABS(lit) <= maxVar && satisfied(lit)) clauseSAT = true;
+				}
+				if (!clauseSAT) {
+					uint64 first = failed;
+					while (c < first && !failed.compare_exchange_weak(first, c));
+					break;
+				}
+			}
+		}
+	};
+	if (nthreads > 1 && nblocks > 1) {
+		Vec<std::thread*> workers;
+		for (int t = 0; t < nthreads; t++) workers.push(new std::thread(worker));
+		for (uint32 t = 0; t < workers.size(); t++) {
+			workers[t]->join();
+			delete workers[t];
+		}
+		workers.clear(true);
+	}
+	else worker();
+	if (failed != UINT64_MAX) {
+		verified = false;
+		const uint64 c = failed, b = c / IMAGE_BLOCK;
+		const Byte* pos = image.data() + image.block(b);
+		for (uint64 i = b * IMAGE_BLOCK; i < c; i++) while (image.next(pos));
+		Lits_t org;
+		uint32 lit;
+		while ((lit = image.next(pos))) org.push(lit);
+		PFLOGN2(1, "  no satisfied literals in clause %lld\t", c + 1);
+		if (verbose >= 1) {
+			bool printvalues = true;
+			forall_clause(org, k) {
+				if (ABS(*k) > maxVar) printvalues = false;
+			}
+			printClause(org, printvalues);
+		}
+		org.clear(true);
+	}
+	orgVars = maxVar;
+	orgClauses = uint32(nclauses);
+	orgLiterals = uint32(image.literals());
+	timer.stop();
+	timer.parse = timer.cpuTime();
+	PFLOG2(1, "  checked %s%d Variables%s, %s%d Clauses%s, and %s%d Literals%s in %s%.2f seconds%s",
+		CREPORTVAL, orgVars, CNORMAL,
+		CREPORTVAL, orgClauses, CNORMAL,
+		CREPORTVAL, orgLiterals, CNORMAL,
+		CREPORTVAL, timer.parse, CNORMAL);
+	if (verified) {
+		PRINT("c model %sVERIFIED%s\n", CGREEN, CNORMAL);
+	}
+	else {
+		PRINT("c model %sNOT VERIFIED%s\n", CRED, CNORMAL);
+	}
+}
+
 void MODEL::saveWitness(const uint32& witness)
 {
 	CHECKLIT(witness);
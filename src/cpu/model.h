@@ -19,6 +19,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #ifndef __MODEL_
 #define __MODEL_
 
+#include "image.h"
 #include "vector.h"
 #include "definitions.h"
 
@@ -27,6 +28,7 @@ namespace pFROST {
 	struct MODEL {
 		Vec<LIT_ST> value, marks;
 		uVec1D lits, resolved;
+		CNFIMAGE image;
 		LIT_ST* orgvalues;
 		uint32 *vorg, maxVar, orgVars, orgClauses, orgLiterals;
 		bool extended, verified;
@@ -43,8 +45,10 @@ namespace pFROST {
 			marks.clear(true);
 			value.clear(true);
 			resolved.clear(true);
+			image.destroy();
 		}
 		void			init			(uint32*);
+		inline void		reset			() { orgvalues = NULL, extended = false; }
 		void			print			();
 		void			printResolved	();
 		void			printValues		();
@@ -52,6 +56,7 @@ namespace pFROST {
 		void			extend			(LIT_ST*);
 		void			verify			(const string&);
 		bool			verify			(char*& clause);
+		void			verifyImage		(const int& nthreads);
 		inline bool		satisfied		(const uint32& orglit) const;
 		inline uint32	size			()					const { return extended ? value.size() - 1 : 0; }
 		inline int		lit2int			(const uint32& lit) const { return SIGN(lit) ? -int(ABS(lit)) : int(ABS(lit)); }
@@ -52,6 +52,7 @@ BOOL_OPT opt_boundsearch_en("boundsearch", "activate search bounds on decisions
 BOOL_OPT opt_chrono_en("chrono", "enable chronological backtracking", true);
 BOOL_OPT opt_bumpreason_en("bumpreason", "bump reason literals via learnt clause", true);
 BOOL_OPT opt_debinary_en("debinary", "remove duplicated binaries", true);
+BOOL_OPT opt_dedup_en("dedup", "remove duplicated clauses while parsing and simplifying", false);
 BOOL_OPT opt_decompose_en("decompose", "decompose binary implication gragh into SCCs", true);
 BOOL_OPT opt_targetphase_en("targetphase", "use target phase in decision making", true);
 BOOL_OPT opt_targetonly_en("targetonly", "use only target phase", false);
@@ -60,21 +61,29 @@ BOOL_OPT opt_ternary_sleep_en("ternarysleep", "allow hyper ternary resolution to
 BOOL_OPT opt_transitive_en("transitive", "enable transitive reduction on binary implication graph", true);
 BOOL_OPT opt_parseonly_en("parseonly", "parse only the input formula", false);
 BOOL_OPT opt_parseincr_en("parseincr", "parse input formula incrementally", false);
+BOOL_OPT opt_parsecompact_en("parsecompact", "give solver slots only to variables occurring in the input", false);
 BOOL_OPT opt_polarity("polarity", "initial variable polarity", true);
 BOOL_OPT opt_proof_en("proof", "enable DRAT proof generation (default: binary)", false);
 BOOL_OPT opt_proof_nonbinary_en("proofnonbinary", "generate proof in binary DRAT format", false);
+BOOL_OPT opt_proof_check_en("proofcheck", "verify the proof online in a background thread (no proof file is written without proof)", false);
+BOOL_OPT opt_lrat_en("lrat", "generate proof in LRAT format with clause identifiers (implies proof)", false);
 BOOL_OPT opt_probe_en("probe", "enable failed literal probing", true);
 BOOL_OPT opt_probe_sleep_en("probesleep", "allow failed literal probing to sleep", true);
 BOOL_OPT opt_probehbr_en("probehyper", "learn hyper binary clauses", true);
 BOOL_OPT opt_model_en("model", "extend model with eliminated variables", false);
 BOOL_OPT opt_modelprint_en("modelprint", "print model on stdout", false);
 BOOL_OPT opt_modelverify_en("modelverify", "verify model on input formula", false);
+BOOL_OPT opt_gc_inplace_en("gcinplace", "collect clause garbage in place by sliding live clauses (lower peak memory)", false);
+BOOL_OPT opt_simd_en("simd", "use AVX2/AVX-512 gathers (if supported) to search long clauses for new watches", true);
+BOOL_OPT opt_perf_en("perfcounters", "attribute hardware performance counters to solver phases (Linux, one system call per phase switch)", false);
+BOOL_OPT opt_hugepages_en("hugepages", "back large clause and list arenas with transparent huge pages (Linux; compare the dTLB miss rate with perfcounters)", false);
 BOOL_OPT opt_mdmlcv_en("mdmlcv", "use least-constrained variables to make multiple decisions", false);
 BOOL_OPT opt_mdmwalk_en("mdmwalk", "enable walk within an initial mdm round", true);
 BOOL_OPT opt_mdmassume_en("mdmassume", "choose multiple decisions based on given assumptions (incremental mode)", false);
 BOOL_OPT opt_report_en("report", "allow performance report on stdout", true);
 BOOL_OPT opt_rephase_en("rephase", "enable variable rephasing", true);
 BOOL_OPT opt_reduce_en("reduce", "enable learnt database reduction", true);
+BOOL_OPT opt_snapshot_en("snapshot", "write a binary snapshot of the parsed/preprocessed formula", false);
 BOOL_OPT opt_sigpre_en("sigma", "enable preprocessing using SIGmA", true);
 BOOL_OPT opt_siglive_en("sigmalive", "enable live SIGmA (inprocessing)", true);
 BOOL_OPT opt_sigsleep_en("sigmasleep", "allow SIGmA to sleep", true);
@@ -96,6 +105,12 @@ INT_OPT opt_minimize_lbd("minimizelbd", "minimum LBD to do binary strengthening"
 INT_OPT opt_minimize_min("minimizemin", "minimum learnt size to do binary strengthening", 30, INT32R(1, 1000));
 INT_OPT opt_minimize_depth("minimizedepth", "minimization depth to explore", 1e3, INT32R(1, INT32_MAX));
 INT_OPT opt_mode_inc("modeinc", "mode increment value based on conflicts", 1e3, INT32R(1, INT32_MAX));
+INT_OPT opt_model_image("modelimage", "keep an image of the input clauses to verify model without re-parsing (0: off, 1: plain, 2: compressed)", 0, INT32R(0, 2));
+INT_OPT opt_verify_threads("verifythreads", "number of threads to verify model on the input image", 1, INT32R(1, 256));
+INT_OPT opt_parse_threads("parsethreads", "number of threads to tokenize the input formula (1: sequential parsing)", 1, INT32R(1, 256));
+INT_OPT opt_proof_buffer("proofbuffer", "size of each proof buffer in MB flushed by a background writer (0: write synchronously)", 4, INT32R(0, 1024));
+INT_OPT opt_proof_buffers("proofbuffers", "number of proof buffers bounding the memory of the background writer", 2, INT32R(2, 64));
+INT_OPT opt_prefetch_dist("prefetchdist", "set the lookahead distance in watches for prefetching clauses during search propagation (0: disable)", 8, INT32R(0, 64));
 INT_OPT opt_nap("nap", "maximum naping period", 2, INT32R(0, 10));
 INT_OPT opt_ternary_priorbins("ternarypriorbins", "prioritize binaries in watch table after hyper ternary resolution (1: enable, 2: prioritize learnts)", 0, INT32R(0, 2));
 INT_OPT opt_ternary_max_eff("ternarymaxeff", "maximum hyper ternary resolution efficiency", 1e2, INT32R(0, INT32_MAX));
@@ -150,12 +165,14 @@ DOUBLE_OPT opt_var_inc("varinc", "VSIDS increment value", 1.0, FP64R(1, 10));
 DOUBLE_OPT opt_var_decay("vardecay", "VSIDS decay value", 0.95, FP64R(0, 1));
 DOUBLE_OPT opt_garbage_perc("garbageperc", "collect garbage if its percentage exceeds this value", 0.25, FP64R(0, 1));
 STRING_OPT opt_proof_out("proofout", "output file to write binary proof", "proof.out");
+STRING_OPT opt_snapshot_out("snapshotout", "output file to write formula snapshot", "formula.snap");
 
 OPTION::OPTION() 
 {
 	RESETSTRUCT(this);
 	int MAXLEN = 256;
 	proof_path = pfcalloc<char>(MAXLEN);
+	snapshot_path = pfcalloc<char>(MAXLEN);
 }
 
 OPTION::~OPTION() 
@@ -164,6 +181,10 @@ OPTION::~OPTION()
 		std::free(proof_path);
 		proof_path = NULL;
 	}
+	if (snapshot_path != NULL) {
+		std::free(snapshot_path);
+		snapshot_path = NULL;
+	}
 }
 
 void OPTION::init() 
@@ -176,6 +197,7 @@ void OPTION::init()
 	conflict_out		= opt_conflictout;
 	decision_out		= opt_decisionout;
 	debinary_en			= opt_debinary_en;
+	dedup_en			= opt_dedup_en;
 	decompose_en		= opt_decompose_en;
 	decompose_min		= opt_decompose_min;
 	decompose_limit		= opt_decompose_limit;
@@ -183,6 +205,7 @@ void OPTION::init()
 	model_en			= opt_model_en;
 	modelprint_en		= opt_modelprint_en;
 	modelverify_en		= opt_modelverify_en;
+	model_image			= opt_model_image;
 	mode_inc			= opt_mode_inc;
 	minimize_min		= opt_minimize_min;
 	minimize_lbd		= opt_minimize_lbd;
@@ -197,10 +220,21 @@ void OPTION::init()
 	map_perc			= opt_map_perc;
 	nap					= opt_nap;
 	memcpy(proof_path, opt_proof_out, opt_proof_out.length());
+	hugepages_en		= opt_hugepages_en;
+	simd_en				= opt_simd_en;
+	perf_en				= opt_perf_en;
 	parseonly_en		= opt_parseonly_en;
 	parseincr_en		= opt_parseincr_en;
+	parsecompact_en		= opt_parsecompact_en;
+	parse_threads		= opt_parse_threads;
+	memcpy(snapshot_path, opt_snapshot_out, opt_snapshot_out.length());
+	snapshot_en			= opt_snapshot_en;
 	proof_en			= opt_proof_en;
 	proof_nonbinary_en	= opt_proof_nonbinary_en;
+	proof_check_en		= opt_proof_check_en;
+	lrat_en				= opt_lrat_en;
+	proof_buffer		= opt_proof_buffer;
+	proof_buffers		= opt_proof_buffers;
 	probe_en			= opt_probe_en;
 	probe_sleep_en		= opt_probe_sleep_en;
 	probehbr_en			= opt_probehbr_en;
@@ -210,6 +244,7 @@ void OPTION::init()
 	probe_max_eff		= opt_probe_max_eff;
 	probe_rel_eff		= opt_probe_rel_eff;
 	prograte			= opt_progress;
+	prefetch_dist		= opt_prefetch_dist;
 	polarity			= opt_polarity;
 	targetonly_en		= opt_targetonly_en;
 	targetphase_en		= opt_targetphase_en;
@@ -228,6 +263,7 @@ void OPTION::init()
 	vsidsonly_en		= opt_vsidsonly_en;
 	var_inc				= opt_var_inc;
 	var_decay			= opt_var_decay;
+	verify_threads		= opt_verify_threads;
 	vivify_en			= opt_vivify_en;
 	vivify_priorbins	= opt_vivify_priorbins;
 	vivify_min_eff		= opt_vivify_min_eff;
@@ -270,6 +306,7 @@ void OPTION::init()
 	luby_max			= opt_luby_max;
 	learntsub_max		= opt_learntsub_max;
 	gc_perc				= opt_garbage_perc;
+	gc_inplace_en		= opt_gc_inplace_en;
 	// SAT competition mode
 	if (competition_en) {
 		assert(proof_path);
@@ -277,6 +314,10 @@ void OPTION::init()
 		proof_en = true, proof_nonbinary_en = false;
 		model_en = true, modelprint_en = true, modelverify_en = false;
 	}
+	if (lrat_en) proof_en = true;
+	// the online checker needs the proof hooks but not the file
+	proof_out_en = proof_en;
+	if (proof_check_en) proof_en = true;
 	// initialize simplifier options
 	if (sigma_en || sigma_live_en) {
 		all_en				= opt_all_en;
@@ -32,6 +32,7 @@ namespace pFROST {
 		LIT_ST	polarity;
 		//------------------------------------------//
 		char*	proof_path;
+		char*	snapshot_path;
 		//------------------------------------------//
 		int64	learntsub_max;
 		//------------------------------------------//
@@ -47,8 +48,14 @@ namespace pFROST {
 		double	ternary_perc;
 		//------------------------------------------//
 		int		nap;
+		int		parse_threads;
+		int		model_image;
+		int		verify_threads;
+		int		proof_buffer;
+		int		proof_buffers;
 		int		seed;
 		int		prograte;
+		int		prefetch_dist;
 		int		mode_inc;
 		int		chrono_min;
 		int		reduce_inc;
@@ -82,12 +89,18 @@ namespace pFROST {
 		bool	boundsearch_en;
 		bool	decompose_en;
 		bool	debinary_en;
+		bool	dedup_en;
 		bool	transitive_en;
 		bool	targetonly_en, targetphase_en;
 		bool	ternary_en, ternary_sleep_en;
 		bool	autarky_en, autarky_sleep_en;
-		bool	proof_en, proof_nonbinary_en;
-		bool	parseonly_en, parseincr_en;
+		bool	proof_en, proof_out_en, proof_nonbinary_en, proof_check_en, lrat_en;
+		bool	parseonly_en, parseincr_en, parsecompact_en;
+		bool	snapshot_en;
+		bool	hugepages_en;
+		bool	simd_en;
+		bool	perf_en;
+		bool	gc_inplace_en;
 		bool	vsids_en, vsidsonly_en;
 		bool	probe_en, probehbr_en, probe_sleep_en;
 		bool	model_en, modelprint_en, modelverify_en;
@@ -0,0 +1,161 @@
+/***********************************************************************[perf.cpp]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#include "perf.h"
+#include <cstdio>
+#include <cstring>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace pFROST;
+
+PERFCOUNTERS::PERFCOUNTERS() : _leader(-1), _opened(0), _top(0), _enabled(false)
+{
+	memset(_counts, 0, sizeof(_counts));
+	memset(_last, 0, sizeof(_last));
+	for (int e = 0; e < PERF_EVENTS; e++) _fd[e] = _slot[e] = -1;
+	_stack[0] = PERF_OTHER;
+}
+
+bool PERFCOUNTERS::init()
+{
+#if defined(__linux__)
+	const uint32 types[PERF_EVENTS] = {
+		PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE,
+		PERF_TYPE_HW_CACHE, PERF_TYPE_HW_CACHE,
+		PERF_TYPE_HARDWARE, PERF_TYPE_SOFTWARE
+	};
+	const uint64 configs[PERF_EVENTS] = {
+		PERF_COUNT_HW_CPU_CYCLES,
+		PERF_COUNT_HW_INSTRUCTIONS,
+		PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+		PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+		PERF_COUNT_HW_BRANCH_MISSES,
+		PERF_COUNT_SW_TASK_CLOCK
+	};
+	destroy();
+	for (int e = 0; e < PERF_EVENTS; e++) {
+		struct perf_event_attr attr;
+		memset(&attr, 0, sizeof(attr));
+		attr.size = sizeof(attr);
+		attr.type = types[e];
+		attr.config = configs[e];
+		attr.disabled = _leader < 0;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		attr.read_format = PERF_FORMAT_GROUP;
+		const int fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, _leader, 0);
+		if (fd < 0) continue;
+		if (_leader < 0) _leader = fd;
+		_fd[e] = fd;
+		_slot[e] = _opened++;
+	}
+	if (_leader < 0) return false;
+	ioctl(_leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+	ioctl(_leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	_top = 0;
+	_enabled = true;
+	sample();
+	memset(_counts, 0, sizeof(_counts));
+	return true;
+#else
+	return false;
+#endif
+}
+
+void PERFCOUNTERS::destroy()
+{
+#if defined(__linux__)
+	for (int e = 0; e < PERF_EVENTS; e++) {
+		if (_fd[e] >= 0) close(_fd[e]);
+		_fd[e] = _slot[e] = -1;
+	}
+#endif
+	_leader = -1, _opened = 0, _enabled = false;
+}
+
+void PERFCOUNTERS::sample()
+{
+#if defined(__linux__)
+	uint64 buffer[PERF_EVENTS + 1];
+	const ssize_t bytes = read(_leader, buffer, sizeof(buffer));
+	if (bytes < (ssize_t)sizeof(uint64) || buffer[0] != uint64(_opened)) return;
+	uint64* phase = _counts[_stack[_top]];
+	for (int e = 0; e < PERF_EVENTS; e++) {
+		const int slot = _slot[e];
+		if (slot < 0) continue;
+		const uint64 value = buffer[slot + 1];
+		phase[e] += value - _last[e];
+		_last[e] = value;
+	}
+#endif
+}
+
+uint64 PERFCOUNTERS::total(const PERF_EVENT& e) const
+{
+	uint64 sum = 0;
+	for (int p = 0; p < PERF_PHASES; p++) sum += _counts[p][e];
+	return sum;
+}
+
+// compact per-phase summary: IPC and misses per kilo-instruction when
+// the hardware counters are there, otherwise the share of task time
+int PERFCOUNTERS::summary(char* buf, const size_t& size, const int& phase) const
+{
+	const uint64* c = _counts[phase];
+	if (available(PERF_INSTRUCTIONS) && c[PERF_INSTRUCTIONS]) {
+		const double kinst = double(c[PERF_INSTRUCTIONS]) / 1000.0;
+		int n = 0;
+		if (available(PERF_CYCLES) && c[PERF_CYCLES])
+			n += snprintf(buf + n, size - n, "ipc %.2f ", double(c[PERF_INSTRUCTIONS]) / double(c[PERF_CYCLES]));
+		if (available(PERF_LLCMISSES))
+			n += snprintf(buf + n, size - n, "llc %.2f ", double(c[PERF_LLCMISSES]) / kinst);
+		if (available(PERF_DTLBMISSES))
+			n += snprintf(buf + n, size - n, "tlb %.2f ", double(c[PERF_DTLBMISSES]) / kinst);
+		if (available(PERF_BRANCHMISSES))
+			n += snprintf(buf + n, size - n, "br %.2f ", double(c[PERF_BRANCHMISSES]) / kinst);
+		return n;
+	}
+	if (available(PERF_TASKCLOCK)) {
+		const uint64 all = total(PERF_TASKCLOCK);
+		return snprintf(buf, size, "%.1f%% time ", all ? 100.0 * double(c[PERF_TASKCLOCK]) / double(all) : 0.0);
+	}
+	return snprintf(buf, size, "n/a ");
+}
+
+const char* PERFCOUNTERS::name(const int& phase)
+{
+	static const char* names[PERF_PHASES] = {
+		"other", "BCP", "analyze", "reduce", "sigma", "VE", "SUB", "BCE", "ERE", "walk", "vivify", "probe"
+	};
+	assert(phase >= 0 && phase < PERF_PHASES);
+	return names[phase];
+}
+
+const char* PERFCOUNTERS::name(const PERF_EVENT& e)
+{
+	static const char* names[PERF_EVENTS] = {
+		"cycles", "instructions", "LLC misses", "dTLB misses", "branch misses", "task ms"
+	};
+	return names[e];
+}
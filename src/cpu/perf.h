@@ -0,0 +1,107 @@
+/***********************************************************************[perf.h]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#ifndef __PERF_
+#define __PERF_
+
+#include <cassert>
+#include <cstddef>
+#include "datatypes.h"
+
+namespace pFROST {
+
+	enum PERF_PHASE {
+		PERF_OTHER = 0,
+		PERF_BCP,
+		PERF_ANALYZE,
+		PERF_REDUCE,
+		PERF_SIGMA,
+		PERF_VE,
+		PERF_SUB,
+		PERF_BCE,
+		PERF_ERE,
+		PERF_WALK,
+		PERF_VIVIFY,
+		PERF_PROBE,
+		PERF_PHASES
+	};
+
+	enum PERF_EVENT {
+		PERF_CYCLES = 0,
+		PERF_INSTRUCTIONS,
+		PERF_LLCMISSES,
+		PERF_DTLBMISSES,
+		PERF_BRANCHMISSES,
+		PERF_TASKCLOCK,
+		PERF_EVENTS
+	};
+
+	#define PERF_DEPTH 16
+
+	/*****************************************************/
+	/*  Usage: one perf_event_open group of hardware     */
+	/*         counters (plus task clock) read at every  */
+	/*         phase switch; the delta is charged to the */
+	/*         innermost running phase                   */
+	/*  Dependency: none                                 */
+	/*****************************************************/
+	class PERFCOUNTERS {
+		uint64	_counts[PERF_PHASES][PERF_EVENTS];
+		uint64	_last[PERF_EVENTS];
+		int		_fd[PERF_EVENTS], _slot[PERF_EVENTS];
+		int		_stack[PERF_DEPTH];
+		int		_leader, _opened, _top;
+		bool	_enabled;
+		void	sample		();
+	public:
+				PERFCOUNTERS	();
+				~PERFCOUNTERS	() { destroy(); }
+		bool	init			();
+		void	destroy			();
+		bool	enabled			() const { return _enabled; }
+		bool	available		(const PERF_EVENT& e) const { return _slot[e] >= 0; }
+		uint64	count			(const int& phase, const PERF_EVENT& e) const { return _counts[phase][e]; }
+		uint64	total			(const PERF_EVENT& e) const;
+		int		summary			(char*, const size_t&, const int&) const;
+		static const char* name	(const int& phase);
+		static const char* name	(const PERF_EVENT& e);
+		inline void	enter		(const int& phase) {
+			if (!_enabled) return;
+			sample();
+			assert(_top + 1 < PERF_DEPTH);
+			_stack[++_top] = phase;
+		}
+		inline void	leave		() {
+			if (!_enabled) return;
+			sample();
+			assert(_top > 0);
+			_top--;
+		}
+	};
+
+	struct PERFSCOPE {
+		PERFCOUNTERS& counters;
+		PERFSCOPE(PERFCOUNTERS& c, const int& phase) : counters(c) { counters.enter(phase); }
+		~PERFSCOPE() { counters.leave(); }
+	};
+
+	#define PERFPHASE(PHASE) PERFSCOPE perfscope(perf, PHASE)
+
+}
+
+#endif
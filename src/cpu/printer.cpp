@@ -66,6 +66,15 @@ void ParaFROST::printStats(const bool& _p, const Byte& _t, const char* _c)
 		SETCOLOR(CNORMAL, stdout);
 		REPCH(' ', RULELEN - solLineLen);
 		PUTCH('\n');
+		if (perf.enabled()) {
+			char summary[128];
+			PFLOGN0("  perf:");
+			for (int p = PERF_BCP; p <= PERF_ANALYZE; p++) {
+				perf.summary(summary, sizeof(summary), p);
+				PRINT(" %s %s", PERFCOUNTERS::name(p), summary);
+			}
+			PUTCH('\n');
+		}
 	}
 }
 
@@ -177,8 +186,8 @@ void ParaFROST::printWL(const uint32& lit, const bool& bin)
 	if (ws.size()) PFLOG1("  list(%d):", -l2i(lit));
 	for (int i = 0; i < ws.size(); i++) {
 		if (!ws[i].binary() && bin) continue;
-		PFLCLAUSE(1, cm[ws[i].ref], "  %sW(r: %-4zd, sz: %-4d, i: %-4d)->%s",
-			CLOGGING, ws[i].ref, ws[i].size, l2i(ws[i].imp), CNORMAL);
+		PFLCLAUSE(1, cm[ws[i].ref], "  %sW(r: %-4zd, bin: %-4d, i: %-4d)->%s",
+			CLOGGING, size_t(ws[i].ref), ws[i].binary(), l2i(ws[i].imp), CNORMAL);
 	}
 }
 
@@ -186,8 +195,8 @@ void ParaFROST::printWL(const WL& ws, const bool& bin)
 {
 	for (int i = 0; i < ws.size(); i++) {
 		if (!ws[i].binary() && bin) continue;
-		PFLCLAUSE(1, cm[ws[i].ref], "  %sW(r: %-4zd, sz: %-4d, i: %-4d)->%s",
-			CLOGGING, ws[i].ref, ws[i].size, l2i(ws[i].imp), CNORMAL);
+		PFLCLAUSE(1, cm[ws[i].ref], "  %sW(r: %-4zd, bin: %-4d, i: %-4d)->%s",
+			CLOGGING, size_t(ws[i].ref), ws[i].binary(), l2i(ws[i].imp), CNORMAL);
 	}
 }
 
@@ -238,7 +247,7 @@ void ParaFROST::printSource()
 		uint32 v = ABS(trail[i]);
 		C_REF r = sp->source[v];
 		if (REASON(r))
-			PFLCLAUSE(1, cm[r], " Source(v:%d, r:%zd)->", v, r);
+			PFLCLAUSE(1, cm[r], " Source(v:%d, r:%zd)->", v, size_t(r));
 	}
 }
 
@@ -59,7 +59,7 @@ void ParaFROST::analyzeFailed(const uint32& failed)
 	analyze();
 	assert(!DL());
 	assert(sp->value[failed] <= 0);
-	if (unassigned(failed)) {
+	if (unassigned(failed) && (!proof.lrat() || chainFailed(failed))) {
 		const uint32 unit = FLIP(failed);
 		PFLOG2(3, "  found unassigned failed probe %d", l2i(unit));
 		enqueueUnit(unit);
@@ -195,6 +195,7 @@ void ParaFROST::FLE()
 
 void ParaFROST::probe()
 {
+	PERFPHASE(PERF_PROBE);
 	rootify();
 	assert(conflict == NOREF);
 	assert(UNSOLVED(cnfstate));
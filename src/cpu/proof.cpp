@@ -35,35 +35,121 @@ using namespace pFROST;
 
 PROOF::PROOF() : 
 	proofFile(NULL)
+	, buffer(NULL)
+	, cursor(NULL)
+	, limit(NULL)
 	, sp(NULL)
 	, vars(NULL)
 	, added(0)
 	, nonbinary_en(false)
+	, cm(NULL)
+	, pool(NULL)
+	, orgid(0)
+	, nextid(0)
+	, lastid(0)
+	, lrat_en(false)
+	, empty_en(false)
 	{}
 
 PROOF::~PROOF()
 { 
 	clause.clear(true);
 	tmpclause.clear(true);
+	units.clear(true);
+	hints.clear(true);
 	close();
 	vars = NULL, sp = NULL, proofFile = NULL;
+	cm = NULL, pool = NULL;
 }
 
 void PROOF::close()
 {
+	checker.stop();
 	if (proofFile != NULL) {
+		if (buffer != NULL) {
+			sink.close(cursor - buffer);
+			buffer = cursor = limit = NULL;
+			if (sink.error()) PFLOGEN("cannot write proof file");
+		}
 		fclose(proofFile);
 		proofFile = NULL;
 	}
 }
 
-void PROOF::handFile(arg_t path, const bool& _nonbinary_en)
+void PROOF::handFile(arg_t path, const bool& _nonbinary_en, const bool& _lrat_en)
 {
 	PFLOGN2(1, " Handing over \"%s%s%s\" to the proof system..", CREPORTVAL, path, CNORMAL);
 	proofFile = fopen(path, "w");
 	if (proofFile == NULL) PFLOGE("cannot open proof file %s", path);
 	nonbinary_en = _nonbinary_en;
-	PFLENDING(1, 5, "(binary %s)", nonbinary_en ? "disabled" : "enabled");
+	lrat_en = _lrat_en;
+	PFLENDING(1, 5, "(%s, binary %s)", lrat_en ? "LRAT" : "DRAT", nonbinary_en ? "disabled" : "enabled");
+}
+
+void PROOF::handChecker()
+{
+	PFLOG2(1, " Checking proof online in a background thread");
+	checker.start();
+}
+
+void PROOF::checkOriginal(Lits_t& c)
+{
+	assert(checker.active());
+	checker.open(CHECK_ORIGINAL, c.size());
+	for (int i = 0; i < c.size(); i++) checker.put(c[i]);
+	checker.commit();
+}
+
+void PROOF::checkResult(const bool& unsat)
+{
+	assert(checker.active());
+	checker.sync();
+	PFLOG2(1, " Online checker verified %lld lemmas (%lld RAT) against %lld original clauses",
+		checker.lemmas() - (checker.error() ? 1 : 0), checker.rats(), checker.originals());
+	if (checker.missing()) PFLOG2(1, " Online checker ignored %lld deletions of unknown clauses", checker.missing());
+	if (checker.error()) {
+		uVec1D& failure = checker.failedClause();
+		PFLOGN1(" Lemma %lld is not implied: ", checker.failedLemma());
+		for (uint32 i = 0; i < failure.size(); i++)
+			PRINT("%d ", SIGN(failure[i]) ? -int(ABS(failure[i])) : int(ABS(failure[i])));
+		PRINT("0\n");
+		PRINT("c proof %sNOT VERIFIED%s\n", CRED, CNORMAL);
+	}
+	else if (unsat) {
+		if (checker.verified()) {
+			PRINT("c proof %sVERIFIED%s\n", CGREEN, CNORMAL);
+		}
+		else {
+			PRINT("c proof %sNOT VERIFIED%s (empty clause is missing)\n", CRED, CNORMAL);
+		}
+	}
+}
+
+void PROOF::initLRAT(const uint32& orgvars, const uint64& orgclauses, CMM& _cm, SPOOL& _pool)
+{
+	assert(lrat_en);
+	assert(!orgid);
+	cm = &_cm, pool = &_pool;
+	cm->identify(), pool->identify();
+	units.resize(orgvars + 1, 0);
+	nextid = orgclauses + 1;
+}
+
+uint64 PROOF::original()
+{
+	assert(lrat_en);
+	if (++orgid >= nextid) PFLOGE("LRAT proof needs the exact number of clauses in the header");
+	return orgid;
+}
+
+void PROOF::handSink(const size_t& bytes, const uint32& nbuffers)
+{
+	assert(proofFile != NULL);
+	assert(buffer == NULL);
+	if (!bytes || nbuffers < 2) return;
+	PFLOG2(1, "  Writing proof asynchronously through %d buffers of %.2f MB", nbuffers, double(bytes) / MBYTE);
+	buffer = cursor = sink.open(proofFile, bytes, nbuffers);
+	limit = buffer + bytes;
 }
 
 void PROOF::init(SP* _sp)
@@ -89,7 +175,24 @@ inline bool PROOF::checkFile()
 	return true;
 }
 
-inline void PROOF::write(const Byte& byte) { writebyte(byte, proofFile); }
+inline void PROOF::write(const Byte& byte)
+{
+	if (cursor < limit) *cursor++ = byte;
+	else flush(byte);
+}
+
+void PROOF::flush(const Byte& byte)
+{
+	if (buffer == NULL) {
+		writebyte(byte, proofFile);
+		return;
+	}
+	assert(cursor == limit);
+	if (sink.error()) PFLOGE("cannot write proof file");
+	buffer = cursor = sink.submit(limit - buffer);
+	limit = buffer + sink.capacity();
+	*cursor++ = byte;
+}
 
 inline void PROOF::write(const uint32* lits, const int& len)
 {
@@ -100,16 +203,31 @@ inline void PROOF::write(const uint32* lits, const int& len)
 	added++;
 }
 
+inline void PROOF::check(const uint32& type, const uint32* lits, const int& len)
+{
+	checker.open(type, len);
+	for (int i = 0; i < len; i++) {
+		const uint32 lit = lits[i];
+		CHECKLIT(lit);
+		checker.put(V2DEC(vars[ABS(lit)], SIGN(lit)));
+	}
+	checker.commit();
+}
+
 inline void	PROOF::addline(const uint32* lits, const int& len)
 {
-	assert(checkFile());
+	if (lrat_en) { lratline(lits, len); return; }
+	if (checker.active()) check(CHECK_ADD, lits, len);
+	if (proofFile == NULL) return;
 	if (!nonbinary_en) write('a');
 	write(lits, len);
 }
 
 inline void	PROOF::delline(const uint32* lits, const int& len)
 {
-	assert(checkFile());
+	if (checker.active()) check(CHECK_DELETE, lits, len);
+	if (proofFile == NULL) return;
+	if (lrat_en) return; // deleted by identifiers only
 	write('d');
 	if (nonbinary_en) write(' ');
 	write(lits, len);
@@ -161,9 +279,99 @@ inline void PROOF::nonbinary(const uint32* lits, const int& len)
 	write('\n');
 }
 
+inline void PROOF::number(uint64 n)
+{
+	char digits[24];
+	int len = 0;
+	do {
+		digits[len++] = char('0' + n % 10);
+		n /= 10;
+	} while (n);
+	while (len) write(digits[--len]);
+}
+
+inline void PROOF::varint(uint64 n)
+{
+	while (n > BYTEMASK) {
+		write(Byte(L2B(n)));
+		n >>= 7;
+	}
+	write(Byte(n));
+}
+
+inline void PROOF::lratline(const uint32* lits, const int& len)
+{
+	assert(lrat_en);
+	assert(hints.size());
+	if (checker.active()) check(CHECK_ADD, lits, len);
+	lastid = nextid++;
+	if (nonbinary_en) {
+		number(lastid);
+		write(' ');
+		for (int i = 0; i < len; i++) {
+			const uint32 lit = lits[i];
+			CHECKLIT(lit);
+			if (SIGN(lit)) write('-');
+			number(vars[ABS(lit)]);
+			write(' ');
+		}
+		write('0');
+		for (uint32 i = 0; i < hints.size(); i++) {
+			write(' ');
+			number(hints[i]);
+		}
+		write(' ');
+		write('0');
+		write('\n');
+	}
+	else {
+		write('a');
+		varint(lastid << 1);
+		for (int i = 0; i < len; i++) {
+			const uint32 lit = lits[i];
+			CHECKLIT(lit);
+			varint(V2DEC(vars[ABS(lit)], SIGN(lit)));
+		}
+		write(0);
+		for (uint32 i = 0; i < hints.size(); i++)
+			varint(hints[i] << 1);
+		write(0);
+	}
+	hints.clear();
+	added++;
+}
+
+inline void PROOF::lratdel(const uint64& i)
+{
+	assert(lrat_en);
+	assert(i);
+	if (nonbinary_en) {
+		number(nextid - 1);
+		write(' ');
+		write('d');
+		write(' ');
+		number(i);
+		write(' ');
+		write('0');
+		write('\n');
+	}
+	else {
+		write('d');
+		varint(i << 1);
+		write(0);
+	}
+}
+
 void PROOF::addEmpty() 
 { 
-	assert(checkFile());
+	if (lrat_en) {
+		if (empty_en) return;
+		empty_en = true;
+		lratline(NULL, 0);
+		return;
+	}
+	if (checker.active()) check(CHECK_ADD, NULL, 0);
+	if (proofFile == NULL) return;
 	if (nonbinary_en) {
 		write('0');
 	}
@@ -178,7 +386,18 @@ inline void PROOF::addClause() { addline(clause, clause.size()); clause.clear();
 
 inline void PROOF::deleteClause() { delline(clause, clause.size()); clause.clear(); }
 
-void PROOF::addUnit(uint32 unit) { addline(&unit, 1); }
+void PROOF::addUnit(uint32 unit)
+{
+	if (lrat_en) {
+		CHECKLIT(unit);
+		uint64& unitid = units[vars[ABS(unit)]];
+		if (unitid) { hints.clear(); return; } // original unit
+		lratline(&unit, 1);
+		unitid = lastid;
+		return;
+	}
+	addline(&unit, 1);
+}
 
 void PROOF::addClause(Lits_t& c) { addline(c, c.size()); }
 
@@ -258,7 +477,7 @@ void PROOF::shrinkClause(CLAUSE& c)
 {
 	assert(clause.empty());
 	assert(sp != NULL);
-	int* levels = sp->level;
+	LEVELS levels = sp->level;
 	for (int i = 0; i < c.size(); i++) {
 		const uint32 lit = c[i], v = ABS(lit);
 		CHECKLIT(lit);
@@ -273,6 +492,78 @@ void PROOF::shrinkClause(CLAUSE& c)
 	deleteClause(c);
 }
 
+void PROOF::deleteID(const uint64& i) { lratdel(i); }
+
+void PROOF::deleteClause(const C_REF& r, CLAUSE& c)
+{
+	if (!lrat_en) { deleteClause(c); return; }
+	lratdel(id(r));
+}
+
+void PROOF::shrinkClause(const C_REF& r, CLAUSE& c)
+{
+	if (!lrat_en) { shrinkClause(c); return; }
+	assert(clause.empty());
+	assert(sp != NULL);
+	LEVELS levels = sp->level;
+	for (int i = 0; i < c.size(); i++) {
+		const uint32 lit = c[i];
+		CHECKLIT(lit);
+		if (levels[ABS(lit)]) clause.push(lit);
+		else {
+			assert(!sp->value[lit]);
+			hintUnit(lit);
+		}
+	}
+	assert(clause.size() > 1);
+	hintClause(r);
+	const uint64 old = id(r);
+	lratline(clause, clause.size());
+	lratdel(old);
+	bind(r);
+	clause.clear();
+}
+
+void PROOF::shrinkClause(const C_REF& r, CLAUSE& c, const uint32& me)
+{
+	if (!lrat_en) { shrinkClause(c, me); return; }
+	assert(clause.empty());
+	assert(sp != NULL);
+	LEVELS levels = sp->level;
+	for (int i = 0; i < c.size(); i++) {
+		const uint32 lit = c[i];
+		CHECKLIT(lit);
+		if (NEQUAL(lit, me) && levels[ABS(lit)]) clause.push(lit);
+	}
+	const uint64 old = id(r);
+	lratline(clause, clause.size());
+	lratdel(old);
+	bind(r);
+	clause.clear();
+}
+
+void PROOF::deleteClause(const S_REF& s)
+{
+	if (!lrat_en) { deleteClause(*s); return; }
+	lratdel(id(s));
+}
+
+void PROOF::addResolvent(const S_REF& s)
+{
+	if (!lrat_en) { addResolvent(*s); return; }
+	lratline(*s, s->size());
+	bind(s);
+}
+
+void PROOF::replaceClause(const S_REF& s)
+{
+	if (!lrat_en) { addResolvent(*s); return; }
+	const uint64 old = id(s);
+	lratline(*s, s->size());
+	lratdel(old);
+	bind(s);
+}
+
 void PROOF::checkInput(arg_t input)
 {
 	PFLOGN2(1, " Handing test clause \"%s%s%s\" to the proof system..", CREPORTVAL, input, CNORMAL);
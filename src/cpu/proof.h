@@ -25,23 +25,41 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "simptypes.h"
 #include "logging.h"
 #include "space.h"
+#include "sink.h"
+#include "checker.h"
+#include "memory.h"
 
 namespace pFROST {
 
 	class PROOF {
 
 		FILE* proofFile;
+		PROOFSINK sink;
+		PROOFCHECKER checker;
+		Byte*	buffer, *cursor, *limit;
 		SP*		sp;
 		uint32*	vars;
 		Lits_t	clause, tmpclause;
 		size_t	added;
 		bool	nonbinary_en;
+		// LRAT clause identifiers are kept in front of the clauses
+		CMM*	cm;
+		SPOOL*	pool;
+		Vec<uint64> units, hints;
+		uint64	orgid, nextid, lastid;
+		bool	lrat_en, empty_en;
 
 		inline void		write		(const Byte&);
+		void			flush		(const Byte&);
 		inline void		write		(const uint32*, const int&);
 		inline void		binary		(const uint32*, const int&);
 		inline void		nonbinary	(const uint32*, const int&);
+		inline void		check		(const uint32&, const uint32*, const int&);
 		inline void		addline		(const uint32*, const int&);
+		inline void		number		(uint64);
+		inline void		varint		(uint64);
+		inline void		lratline	(const uint32*, const int&);
+		inline void		lratdel		(const uint64&);
 		inline void		delline		(const uint32*, const int&);
 		inline int		exists		(uint32*, const int&);
 		inline int		exists		();
@@ -55,10 +73,20 @@ namespace pFROST {
 		~PROOF	();
 
 		size_t numClauses		() const { return added; }
+		bool async				() const { return buffer != NULL; }
+		uint64 bytes			() const { return sink.bytes() + (cursor - buffer); }
+		uint64 stalls			() const { return sink.stalls(); }
+		double stallTime		() const { return sink.stallTime(); }
 		void close				();
 		void init				(SP*);
 		void init				(SP*, uint32*);
-		void handFile			(arg_t path, const bool&);
+		void handFile			(arg_t path, const bool&, const bool& lrat = false);
+		void handSink			(const size_t&, const uint32&);
+		void handChecker		();
+		void checkOriginal		(Lits_t&);
+		void checkResult		(const bool& unsat);
+		bool checking			() const { return checker.active(); }
+		PROOFCHECKER& online	() { return checker; }
 		void checkInput			(arg_t input);
 		void addEmpty			();
 		void addUnit			(uint32);
@@ -78,6 +106,37 @@ namespace pFROST {
 		void resolve			(const uint32&, SCLAUSE&, SCLAUSE&);
 		bool merge				(const uint32&, SCLAUSE&, SCLAUSE&);
 		void printClause		(const char*, const uint32*, const int&, const bool& map = false);
+		// LRAT
+		bool lrat				() const { return lrat_en; }
+		void initLRAT			(const uint32& orgvars, const uint64& orgclauses, CMM&, SPOOL&);
+		uint64 original			();
+		uint64 id				(const C_REF& r) const { return cm->id(r); }
+		uint64 unit				(const uint32& lit) const {
+			CHECKLIT(lit);
+			assert(units[vars[ABS(lit)]]);
+			return units[vars[ABS(lit)]];
+		}
+		void bind				(const C_REF& r) { assert(lastid); cm->setID(r, lastid); }
+		void bind				(const C_REF& r, const uint64& i) { cm->setID(r, i); }
+		void bindUnit			(const uint32& lit, const uint64& i) { CHECKLIT(lit); units[vars[ABS(lit)]] = i; }
+		void hint				(const uint64& i) { assert(i); hints.push(i); }
+		void hintUnit			(const uint32& lit) { hints.push(unit(lit)); }
+		void hintClause			(const C_REF& r) { hints.push(id(r)); }
+		void clearHints			() { hints.clear(); }
+		void deleteID			(const uint64&);
+		void deleteClause		(const C_REF&, CLAUSE&);
+		void shrinkClause		(const C_REF&, CLAUSE&);
+		void shrinkClause		(const C_REF&, CLAUSE&, const uint32&);
+		// LRAT identifiers of simplified clauses, which
+		// are handed over from and back to the clause memory
+		uint64 id				(const S_REF& s) const { return pool->id(s); }
+		void bind				(const S_REF& s) { assert(lastid); pool->setID(s, lastid); }
+		void hintClause			(const S_REF& s) { hints.push(id(s)); }
+		void transfer			(const C_REF& from, const S_REF& to) { pool->setID(to, cm->id(from)); }
+		void transfer			(const S_REF& from, const C_REF& to) { cm->setID(to, pool->id(from)); }
+		void deleteClause		(const S_REF&);
+		void addResolvent		(const S_REF&);
+		void replaceClause		(const S_REF&);
 
 	};
 
@@ -21,18 +21,27 @@ using namespace pFROST;
 
 inline void ParaFROST::moveClause(C_REF& r, CMM& newBlock)
 {
-	assert(r < cm.size());
+	assert(cm.valid(r));
+	if (!newBlock.moving(r)) return; // generation is kept as is
 	CLAUSE& c = cm[r];
 	assert(!c.deleted());
 	if (c.moved()) { r = c.ref(); return; }
-	r = newBlock.alloc(c);
+	const C_REF old = r;
+	// a learnt promoted to original leaves the learnt generation
+	const bool learnt = CMM::learntGen(old) && c.learnt();
+	// appended to the kept original generation unless it is moving
+	CMM& dest = (learnt || newBlock.moving(0)) ? newBlock : cm;
+	r = dest.alloc(c, learnt);
+	if (proof.lrat()) dest.setID(r, cm.id(old));
 	c.set_ref(r);
 }
 
 inline void	ParaFROST::moveWatches(WL& ws, CMM& new_cm)
 {
 	forall_watches(ws, w) {
-		moveClause(w->ref, new_cm);
+		C_REF r = w->ref;
+		moveClause(r, new_cm);
+		w->ref = r;
 	}
 	ws.shrinkCap();
 }
@@ -51,7 +60,7 @@ inline void	ParaFROST::recycleWL(const uint32& lit)
 		if (cm.deleted(r)) continue;
 		CLAUSE& c = cm[r];
 		w.imp = c[0] ^ c[1] ^ flit;
-		w.size = c.size();
+		w.resize(c.size());
 		if (c.binary()) {
 			if (c.hyper()) hypers.push(w);
 			else *j++ = w;
@@ -66,7 +75,7 @@ inline void	ParaFROST::recycleWL(const uint32& lit)
 void ParaFROST::markReasons() 
 {
 	const VSTATE* states = sp->vstate;
-	const C_REF* sources = sp->source;
+	const SOURCES sources = sp->source;
 	forall_vector(uint32, trail, t) {
 		const uint32 lit = *t, v = ABS(lit);
 		if (states[v].state) continue;
@@ -83,7 +92,7 @@ void ParaFROST::markReasons()
 void ParaFROST::unmarkReasons() 
 {
 	const VSTATE* states = sp->vstate;
-	const C_REF* sources = sp->source;
+	const SOURCES sources = sp->source;
 	forall_vector(uint32, trail, t) {
 		const uint32 lit = *t, v = ABS(lit);
 		if (states[v].state) continue;
@@ -105,13 +114,14 @@ void ParaFROST::recycleWT()
 	}
 	forall_cnf(learnts, i) {
 		const C_REF r = *i;
-		assert(r < cm.size());
+		assert(cm.valid(r));
 		if (cm.deleted(r)) continue;
 		CLAUSE& c = cm[r];
 		if (c.binary()) continue;
 		sortClause(c);
 		attachWatch(r, c);
 	}
+	wt.compact();
 }
 
 void ParaFROST::recycle(CMM& new_cm)
@@ -124,14 +134,14 @@ void ParaFROST::recycle(CMM& new_cm)
 		moveWatches(wt[lit], new_cm);
 		moveWatches(wt[flit], new_cm);
 	}
-	C_REF* sources = sp->source;
-	int* levels = sp->level;
+	SOURCES sources = sp->source;
+	LEVELS levels = sp->level;
 	forall_vector(uint32, trail, t) {
 		const uint32 lit = *t, v = ABS(lit);
 		C_REF& r = sources[v];
 		if (REASON(r)) {
 			if (levels[v]) {
-				assert(r < cm.size());
+				assert(cm.valid(r));
 				if (cm.deleted(r)) r = NOREF;
 				else moveClause(r, new_cm);
 			}
@@ -143,8 +153,106 @@ void ParaFROST::recycle(CMM& new_cm)
 	orgs.shrinkCap();
 }
 
+// new reference of the live clause 'r', stored in its old header
+// if its generation slides (kept generations stay put)
+inline C_REF forward(const CMM& cm, const bool* gens, const C_REF& r)
+{
+	if (!gens[CMM::learntGen(r)]) return r;
+	return cm[r].ref();
+}
+
+void ParaFROST::slide(const bool* gens)
+{
+	reduced.clear(true);
+	analyzed.clear(true);
+	recycleWT();
+	filter(orgs);
+	filter(learnts);
+	// live clauses of the sliding generations in address order
+	BCNF from;
+	from.reserve(orgs.size() + learnts.size());
+	forall_cnf(orgs, i) { if (gens[CMM::learntGen(*i)]) from.push(*i); }
+	forall_cnf(learnts, i) { if (gens[CMM::learntGen(*i)]) from.push(*i); }
+	rSort(from.data(), from.size());
+	// the new reference of a clause overwrites its first two
+	// literals in the old header, which are saved until it slides;
+	// an LRAT identifier in front of the header slides with it
+	uVec1D saved(from.size() << 1), promoted;
+	const C_REF idwords = cm.idwords();
+	C_REF next[GENERATIONS] = { 0, 0 };
+	for (uint32 i = 0; i < from.size(); i++) {
+		const C_REF r = from[i];
+		const int g = CMM::learntGen(r);
+		CLAUSE& c = cm[r];
+		assert(!c.moved());
+		saved[i << 1] = c[0], saved[(i << 1) + 1] = c[1];
+		if (g && c.original()) { promoted.push(i); continue; }
+		const C_REF d = next[g] + idwords;
+		c.set_ref(g ? (d | LEARNTGEN) : d);
+		next[g] += C_REF(cm.footprint(c.size()));
+	}
+	// learnts promoted to originals are appended to the original generation
+	const C_REF first = gens[0] ? next[0] : cm.size(0);
+	C_REF end = first;
+	forall_vector(uint32, promoted, i) {
+		CLAUSE& c = cm[from[*i]];
+		c.set_ref(end + idwords);
+		end += C_REF(cm.footprint(c.size()));
+	}
+	// redirect watches, reasons and clause lists
+	forall_literal(lit) {
+		forall_watches(wt[lit], w) { w->ref = forward(cm, gens, w->ref); }
+	}
+	SOURCES sources = sp->source;
+	LEVELS levels = sp->level;
+	forall_vector(uint32, trail, t) {
+		const uint32 v = ABS(*t);
+		C_REF& r = sources[v];
+		if (REASON(r)) {
+			if (levels[v] && !cm.deleted(r)) r = forward(cm, gens, r);
+			else r = NOREF;
+		}
+	}
+	forall_cnf(orgs, i) { *i = forward(cm, gens, *i); }
+	forall_cnf(learnts, i) { *i = forward(cm, gens, *i); }
+	// slide clauses down restoring their saved literals;
+	// a destination never passes its source and promoted
+	// clauses are copied before the learnts slide
+	uint32 i = 0;
+	for (; i < from.size() && !CMM::learntGen(from[i]); i++) {
+		const C_REF r = from[i];
+		CLAUSE& c = cm[r];
+		const C_REF d = c.ref();
+		assert(d <= r);
+		c.initMoved(), c[0] = saved[i << 1], c[1] = saved[(i << 1) + 1];
+		if (d < r) std::memmove(cm.address(d) - idwords, cm.address(r) - idwords, cm.footprint(c.size()) * hc_isize);
+	}
+	// a sliding original generation is sized once, including the promoted clauses
+	if (gens[0]) cm.slid(0, first, end);
+	forall_vector(uint32, promoted, p) {
+		CLAUSE& c = cm[from[*p]];
+		c.initMoved(), c[0] = saved[*p << 1], c[1] = saved[(*p << 1) + 1];
+		const C_REF d = cm.alloc(c, false);
+		if (proof.lrat()) cm.setID(d, cm.id(from[*p]));
+	}
+	assert(cm.size(0) == end);
+	for (; i < from.size(); i++) {
+		const C_REF r = from[i];
+		CLAUSE& c = cm[r];
+		if (!c.moved()) continue; // promoted
+		const C_REF d = c.ref();
+		assert(CMM::learntGen(d));
+		assert(d <= r);
+		c.initMoved(), c[0] = saved[i << 1], c[1] = saved[(i << 1) + 1];
+		if (d < r) std::memmove(cm.address(d) - idwords, cm.address(r) - idwords, cm.footprint(c.size()) * hc_isize);
+	}
+	if (gens[1]) cm.slid(1, next[1], next[1]);
+	orgs.shrinkCap();
+}
+
 void ParaFROST::recycle() 
 {
+	PERFPHASE(PERF_REDUCE);
 	assert(sp->propagated == trail.size());
 	assert(conflict == NOREF);
 	assert(UNSOLVED(cnfstate));
@@ -153,12 +261,20 @@ void ParaFROST::recycle()
 		PFLOGN2(2, " Recycling garbage..");
 		stats.recycle.hard++;
 		assert(cm.size() >= cm.garbage());
-		const size_t bytes = cm.size() - cm.garbage();
-		CMM new_cm(bytes);
-		recycle(new_cm);
-		PFLGCMEM(2, cm, new_cm);
-		new_cm.migrateTo(cm);
-		PFLDONE(2, 5);
+		// collect only the generations with enough garbage,
+		// usually the learnt one after a reduction
+		const bool gens[GENERATIONS] = { cm.collectable(0, opts.gc_perc), cm.collectable(1, opts.gc_perc) };
+		if (!gens[0]) stats.recycle.learnt++;
+		const C_REF before = cm.size();
+		if (opts.gc_inplace_en) slide(gens);
+		else {
+			CMM new_cm;
+			new_cm.target(cm, gens);
+			recycle(new_cm);
+			new_cm.adopt(cm);
+			new_cm.migrateTo(cm);
+		}
+		PFLENDING(2, 5, "(%.2f KB saved)", double(before - cm.size()) * cm.bucket() / KBYTE);
 	}
 	else {
 		stats.recycle.soft++;
@@ -187,7 +303,7 @@ void ParaFROST::filter(BCNF& cnf, CMM& new_cm)
 	forall_cnf(cnf, i) {
 		C_REF r = *i;
 		if (cm.deleted(r)) continue;
-		moveClause(r, new_cm);
+		if (new_cm.moving(r)) moveClause(r, new_cm);
 		*j++ = r; // must follow moveClause
 	}
 	assert(j >= cnf);
@@ -48,6 +48,7 @@ bool ParaFROST::chronoHasRoot() {
 
 void ParaFROST::reduce()
 {
+	PERFPHASE(PERF_REDUCE);
 	assert(sp->propagated == trail.size());
 	assert(conflict == NOREF);
 	assert(UNSOLVED(cnfstate));
@@ -101,7 +102,7 @@ void ParaFROST::reduceLearnts()
 	const C_REF rsize = reduced.size();
 	if (rsize) {
 		C_REF pivot = opts.reduce_perc * rsize;
-		PFLOGN2(2, " Reducing learnt database up to (%zd clauses)..", pivot);
+		PFLOGN2(2, " Reducing learnt database up to (%zd clauses)..", size_t(pivot));
 		end = reduced.end();
 		C_REF* head = reduced.data();
 		std::stable_sort(head, end, LEARNT_CMP(cm));
@@ -27,7 +27,8 @@ void ParaFROST::newClause(SCLAUSE& s)
 	assert(!s.molten());	
 	// NOTE: 's' should be used before any mapping is done
 	if (stats.sigma.calls > 1 && s.added()) markSubsume(s);
-	C_REF r = cm.alloc(size);
+	C_REF r = cm.alloc(size, s.learnt());
+	if (proof.lrat()) proof.transfer(&s, r);
 	CLAUSE& new_c = cm[r];
 	if (mapped) vmap.mapClause(new_c, s);
 	else new_c.copyLitsFrom(s);
@@ -82,11 +83,3 @@ void ParaFROST::removeClause(SCLAUSE& c)
 			proof.deleteClause(c);
 	}
 }
-
-void ParaFROST::deleteClause(S_REF& c)
-{
-	if (c) {
-		delete c;
-		c = NULL;
-	}
-}
\ No newline at end of file
@@ -54,7 +54,7 @@ CL_ST ParaFROST::rooted(CLAUSE& c)
 {
 	assert(!c.deleted());
 	CL_ST st = UNDEFINED;
-	const int* levels = sp->level;
+	const LEVELS levels = sp->level;
 	const LIT_ST* values = sp->value;
 	forall_clause(c, k) {
 		const uint32 lit = *k;
@@ -71,7 +71,7 @@ CL_ST ParaFROST::rooted(CLAUSE& c)
 
 int ParaFROST::removeRooted(CLAUSE& c)
 {
-	const int* levels = sp->level;
+	const LEVELS levels = sp->level;
 	uint32* j = c;
 	forall_clause(c, i) {
 		const uint32 lit = *i;
@@ -99,7 +99,7 @@ void ParaFROST::shrinkClause(CLAUSE& c, const int& remLits)
 		stats.literals.original -= remLits;
 	}
 	if (keeping(c)) markSubsume(c);
-	cm.collectLiterals(remLits);
+	cm.collectLiterals(c, remLits);
 }
 
 void ParaFROST::shrinkClause(const C_REF& r)
@@ -119,7 +119,7 @@ void ParaFROST::shrinkClause(const C_REF& r)
 		}
 	}
 	if (numNonFalse < 2) return;
-	if (opts.proof_en) proof.shrinkClause(c);
+	if (opts.proof_en) proof.shrinkClause(r, c);
 	shrinkClause(c, removeRooted(c));
 }
 
@@ -206,6 +206,7 @@ void ParaFROST::shrinkTop(BCNF& cnf)
 		CL_ST st = rootedTop(c);
 		if (st > 0) removeClause(c, r);
 		else if (!st) {
+			if (proof.lrat()) proof.shrinkClause(r, c);
 			shrinkClause(c, removeRooted(c));
 			*j++ = r;
 		}
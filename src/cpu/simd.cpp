@@ -0,0 +1,95 @@
+/***********************************************************************[simd.cpp]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#include "simd.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SIMD_X86
+#include <immintrin.h>
+#endif
+
+namespace pFROST {
+
+	static uint32* searchScalar(uint32* k, uint32* end, const LIT_ST* values)
+	{
+		while (k != end && !values[*k]) k++;
+		return k;
+	}
+
+#if defined(SIMD_X86)
+
+	__attribute__((target("avx2")))
+	static uint32* searchAVX2(uint32* k, uint32* end, const LIT_ST* values)
+	{
+		const int* base = (const int*)values;
+		const __m256i lowbyte = _mm256_set1_epi32(0xFF);
+		const __m256i zero = _mm256_setzero_si256();
+		while (end - k >= 8) {
+			const __m256i lits = _mm256_loadu_si256((const __m256i*)k);
+			const __m256i vals = _mm256_and_si256(_mm256_i32gather_epi32(base, lits, 1), lowbyte);
+			const uint32 nonfalse = ~uint32(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(vals, zero)))) & 0xFF;
+			if (nonfalse) return k + __builtin_ctz(nonfalse);
+			k += 8;
+		}
+		return searchScalar(k, end, values);
+	}
+
+	__attribute__((target("avx512f")))
+	static uint32* searchAVX512(uint32* k, uint32* end, const LIT_ST* values)
+	{
+		const __m512i lowbyte = _mm512_set1_epi32(0xFF);
+		while (end - k >= 16) {
+			const __m512i lits = _mm512_loadu_si512((const void*)k);
+			const __m512i vals = _mm512_mask_i32gather_epi32(_mm512_setzero_si512(), 0xFFFF, lits, (const void*)values, 1);
+			const uint32 nonfalse = _mm512_test_epi32_mask(vals, lowbyte);
+			if (nonfalse) return k + __builtin_ctz(nonfalse);
+			k += 16;
+		}
+		return searchScalar(k, end, values);
+	}
+
+#endif
+
+	SEARCH_KERNEL searchkernel = searchScalar;
+
+	SIMD_KERNEL initSIMD(const bool& enable)
+	{
+		SIMD_KERNEL kernel = SIMD_SCALAR;
+#if defined(SIMD_X86)
+		if (enable) {
+			__builtin_cpu_init();
+			if (__builtin_cpu_supports("avx512f")) kernel = SIMD_AVX512;
+			else if (__builtin_cpu_supports("avx2")) kernel = SIMD_AVX2;
+		}
+		if (kernel == SIMD_AVX512) searchkernel = searchAVX512;
+		else if (kernel == SIMD_AVX2) searchkernel = searchAVX2;
+		else searchkernel = searchScalar;
+#else
+		searchkernel = searchScalar;
+#endif
+		return kernel;
+	}
+
+	const char* simdName(const SIMD_KERNEL& kernel)
+	{
+		if (kernel == SIMD_AVX512) return "AVX-512";
+		if (kernel == SIMD_AVX2) return "AVX2";
+		return "scalar";
+	}
+
+}
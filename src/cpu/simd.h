@@ -0,0 +1,59 @@
+/***********************************************************************[simd.h]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#ifndef __SIMD_
+#define __SIMD_
+
+#include "datatypes.h"
+
+namespace pFROST {
+
+	// ranges shorter than this are scanned by the inlined scalar loop
+	#define SIMD_MINLITS 16
+
+	enum SIMD_KERNEL { SIMD_SCALAR = 0, SIMD_AVX2 = 1, SIMD_AVX512 = 2 };
+
+	typedef uint32* (*SEARCH_KERNEL)(uint32*, uint32*, const LIT_ST*);
+
+	extern SEARCH_KERNEL searchkernel;
+
+	/*****************************************************/
+	/*  Usage: select the widest literal-search kernel   */
+	/*         the running CPU supports                  */
+	/*  Dependency: none                                 */
+	/*****************************************************/
+	SIMD_KERNEL		initSIMD		(const bool& enable);
+	const char*		simdName		(const SIMD_KERNEL&);
+
+	/*****************************************************/
+	/*  Usage: first literal in [k, end) that is not     */
+	/*         false, or 'end' if all are false; gather  */
+	/*         kernels read 4 bytes at 'values + lit' so */
+	/*         'values' must have 3 bytes of slack after */
+	/*         the last literal (true for SP arrays)     */
+	/*  Dependency: searchkernel                         */
+	/*****************************************************/
+	inline uint32*	nonFalse		(uint32* k, uint32* end, const LIT_ST* values) {
+		if (end - k >= SIMD_MINLITS) return searchkernel(k, end, values);
+		while (k != end && !values[*k]) k++;
+		return k;
+	}
+
+}
+
+#endif
@@ -35,20 +35,35 @@ inline bool	ParaFROST::checkMem(const string& _name, const size_t& size)
 void ParaFROST::createOT(const bool& reset)
 {
 	if (opts.profile_simp) timer.pstart();
-	if (reset) {
-		forall_variables(v) { 
-			const uint32 p = V2L(v); 
-			ot[p].clear(); 
-			ot[NEG(p)].clear();
+	if (reset) { // histogram pass then fill one flat (CSR) table
+		uVec1D sizes(ot.size(), 0);
+		forall_vector(S_REF, scnf, i) {
+			S_REF c = *i;
+			if (c->learnt() || c->original()) {
+				forall_clause((*c), k) { sizes[*k]++; }
+			}
+		}
+		ot.layout(sizes, true);
+		forall_vector(S_REF, scnf, i) {
+			S_REF c = *i;
+			if (c->learnt() || c->original()) {
+				assert(c->size());
+				forall_clause((*c), k) {
+					CHECKLIT(*k);
+					ot[*k].insert(c);
+				}
+			}
 		}
 	}
-	forall_vector(S_REF, scnf, i) {
-		S_REF c = *i;
-		if (c->learnt() || c->original()) {
-			assert(c->size());
-			forall_clause((*c), k) { 
-				CHECKLIT(*k);
-				ot[*k].push(*i);
+	else {
+		forall_vector(S_REF, scnf, i) {
+			S_REF c = *i;
+			if (c->learnt() || c->original()) {
+				assert(c->size());
+				forall_clause((*c), k) {
+					CHECKLIT(*k);
+					ot[*k].push(c);
+				}
 			}
 		}
 	}
@@ -101,12 +116,12 @@ void ParaFROST::extract(BCNF& cnf)
 		if (cm.deleted(ref)) continue;
 		const CLAUSE& c = cm[ref];
 		const int size = c.size();
-		const size_t bytes = hc_scsize + (size - 1) * hc_isize;
-		S_REF s = (S_REF) new Byte[bytes];
+		S_REF s = spool.alloc(size);
 		s->init(c);
 		assert(s->size() == size);
 		s->calcSig();
 		rSort(s->data(), size);
+		if (proof.lrat()) proof.transfer(ref, s);
 		scnf[inf.nClauses++] = s;
 		inf.nLiterals += size;
 	}
@@ -114,6 +129,7 @@ void ParaFROST::extract(BCNF& cnf)
 
 void ParaFROST::sigmify()
 {
+	PERFPHASE(PERF_SIGMA);
 	if (!opts.phases && !(opts.all_en || opts.ere_en)) return;
 	assert(conflict == NOREF);
 	assert(UNSOLVED(cnfstate));
@@ -134,12 +150,14 @@ void ParaFROST::awaken()
 	PFLOGN2(2, " Allocating memory..");
 	const size_t numCls = size_t(maxClauses()), numLits = size_t(maxLiterals());
 	const size_t ot_cap = inf.nDualVars * sizeof(OL) + numLits * sizeof(S_REF);
-	const size_t scnf_cap = numCls * sizeof(S_REF) + numLits * sizeof(uint32);
+	const size_t pool_cap = numCls * (spool.idbytes() + hc_scsize - hc_isize) + numLits * hc_isize;
+	const size_t scnf_cap = numCls * sizeof(S_REF) + pool_cap;
 	if (!checkMem("ot", ot_cap) || !checkMem("scnf", scnf_cap)) {
 		simpstate = AWAKEN_FAIL; 
 		return;
 	}
 	ot.resize(inf.nDualVars), scnf.resize(numCls);
+	spool.destroy(), spool.reserve(pool_cap);
 	PFLENDING(2, 5, "(%.1f MB used)", double(ot_cap + scnf_cap) / MBYTE);
 	PFLOGN2(2, " Extracting clauses to simplifying CNF..");
 	printStats(1, '-', CGREEN0);
@@ -237,10 +255,11 @@ void ParaFROST::shrinkSimp()
 	S_REF* j = scnf;
 	forall_vector(S_REF, scnf, i) {
 		S_REF c = *i;
-		if (c->deleted()) deleteClause(c);
-		else *j++ = c;
+		if (!c->deleted()) *j++ = c;
+		else if (proof.lrat()) proof.deleteClause(c);
 	}
 	scnf.resize(uint32(j - scnf));
+	spool.compact(scnf);
 	if (opts.profile_simp) timer.stop(), timer.gc += timer.cpuTime();
 }
 
@@ -250,16 +269,23 @@ void ParaFROST::newBeginning()
 	assert(wt.empty());
 	assert(orgs.empty());
 	assert(learnts.empty());
+	const uint64 duplicates = dedup();
+	if (duplicates) {
+		stats.duplicates.rebuilt += duplicates;
+		shrinkSimp();
+		countAll();
+		inf.nClauses = inf.n_cls_after;
+		inf.nLiterals = inf.n_lits_after;
+	}
 	assert(inf.nClauses == scnf.size());
-	const int64 litsCap = (inf.nLiterals - (inf.nClauses << 1)) * sizeof(uint32);
-	assert(litsCap >= 0);
-	const C_REF bytes = inf.nClauses * sizeof(CLAUSE) + size_t(litsCap);
-	cm.init(bytes);
+	C_REF caps[GENERATIONS] = { 0, 0 };
+	forall_vector(S_REF, scnf, s) { caps[(*s)->learnt()] += C_REF(cm.footprint((*s)->size())); }
+	cm.init(caps[0], caps[1]);
 	stats.literals.original = stats.literals.learnt = 0;
 	if (opts.aggr_cnf_sort) std::stable_sort(scnf.data(), scnf.data() + scnf.size(), CNF_CMP_KEY());
 	forall_vector(S_REF, scnf, s) { newClause(**s); }
 	stats.clauses.original = orgs.size();
 	stats.clauses.learnt = learnts.size();
 	assert(maxClauses() == int64(scnf.size()));
-	scnf.clear(true);
+	scnf.clear(true), spool.destroy();
 }
\ No newline at end of file
@@ -20,15 +20,94 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #define __SIMP_TYPES_
 
 #include "datatypes.h"
-#include "vector.h"
+#include "lists.h"
 #include "sclause.h"
 
 namespace pFROST {
 
-	typedef Vec<S_REF, int> OL;
-	typedef Vec<OL> OT;
+	typedef SVec<S_REF> OL;
+	typedef LISTS<S_REF> OT;
 	typedef Vec<S_REF, size_t> SCNF;
 
+	/*****************************************************/
+	/*  Usage: bump allocator for simplifier clauses     */
+	/*         carved from a few large segments that     */
+	/*         never move, so S_REF pointers stay valid  */
+	/*         until the pool is compacted or destroyed; */
+	/*         with LRAT proofs each clause is preceded  */
+	/*         by its 64-bit identifier                  */
+	/*  Dependency:  SCLAUSE, SCNF                       */
+	/*****************************************************/
+	class SPOOL {
+		Vec<Byte*> _segs;
+		Byte* _head, * _tail;
+		size_t _cap, _used, _reclaimed, _idbytes;
+		inline void			add			(Byte* seg, const size_t& nbytes) {
+			_segs.push(seg);
+			_head = seg, _tail = seg + nbytes;
+			_cap += nbytes;
+		}
+	public:
+							~SPOOL		() { destroy(); }
+							SPOOL		() : _head(NULL), _tail(NULL), _cap(0), _used(0), _reclaimed(0), _idbytes(0) { }
+		inline size_t		bytes		(const int& size) const { assert(size > 0); return _idbytes + hc_scsize + size_t(size - 1) * hc_isize; }
+		inline size_t		idbytes		() const { return _idbytes; }
+		inline void			identify	() { assert(!_used); _idbytes = IDWORDS * hc_isize; }
+		inline uint64		id			(const S_REF& s) const {
+			assert(_idbytes);
+			const uint32* w = (const uint32*)s - IDWORDS;
+			return uint64(w[0]) | (uint64(w[1]) << 32);
+		}
+		inline void			setID		(const S_REF& s, const uint64& i) {
+			assert(_idbytes);
+			assert(i);
+			uint32* w = (uint32*)s - IDWORDS;
+			w[0] = uint32(i), w[1] = uint32(i >> 32);
+		}
+		inline size_t		capacity	() const { return _cap; }
+		inline size_t		used		() const { return _used; }
+		inline size_t		reclaimed	() const { return _reclaimed; }
+		inline void			reserve		(const size_t& nbytes) {
+			if (!nbytes) return;
+			Byte* seg = pfmalloc<Byte>(nbytes);
+			pfadvise(seg, nbytes);
+			add(seg, nbytes);
+		}
+		inline S_REF		alloc		(const int& size) {
+			const size_t nbytes = bytes(size);
+			if (size_t(_tail - _head) < nbytes) reserve(std::max(nbytes, (_cap >> 2) + KBYTE));
+			S_REF s = (S_REF)(_head + _idbytes);
+			_head += nbytes, _used += nbytes;
+			return s;
+		}
+		inline void			compact		(SCNF& scnf) {
+			size_t live = 0;
+			forall_vector(S_REF, scnf, i) {
+				assert(!(*i)->deleted());
+				live += bytes((*i)->size());
+			}
+			Byte* seg = live ? pfmalloc<Byte>(live) : NULL;
+			pfadvise(seg, live);
+			Byte* next = seg;
+			forall_vector(S_REF, scnf, i) {
+				const size_t nbytes = bytes((*i)->size());
+				std::memcpy(next, (Byte*)*i - _idbytes, nbytes);
+				*i = (S_REF)(next + _idbytes);
+				next += nbytes;
+			}
+			assert(next == seg + live);
+			if (_cap > live) _reclaimed += _cap - live;
+			destroy();
+			if (seg) add(seg, live), _head = _tail, _used = live;
+		}
+		inline void			destroy		() {
+			for (uint32 i = 0; i < _segs.size(); i++) std::free(_segs[i]);
+			_segs.clear(true);
+			_head = _tail = NULL;
+			_cap = _used = 0;
+		}
+	};
+
 
 	#define forall_occurs(LIST, PTR) \
 		for (S_REF* PTR = LIST, *END = LIST.end(); PTR != END; PTR++)
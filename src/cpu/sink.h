@@ -0,0 +1,157 @@
+/***********************************************************************[sink.h]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#ifndef __SINK_
+#define __SINK_
+
+#include "definitions.h"
+#include "logging.h"
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+
+namespace pFROST {
+
+	/*****************************************************/
+	/*  Usage: fixed number of proof buffers filled by   */
+	/*         the solver and flushed to the proof file  */
+	/*         by a background writer; the solver stalls */
+	/*         only if all buffers are waiting on disk   */
+	/*****************************************************/
+	class PROOFSINK {
+		struct BUFFER {
+			Byte* data;
+			size_t size;
+		} *buffers;
+		std::mutex lock;
+		std::condition_variable fullcv, emptycv;
+		std::thread* writer;
+		FILE* file;
+		size_t cap;
+		uint64 nbytes, nstalls;
+		double stalltime;
+		uint32 nbuffers, head, count, tail;
+		bool stopped;
+		std::atomic<bool> failed;
+
+		inline void flush() {
+			while (true) {
+				{
+					std::unique_lock<std::mutex> guard(lock);
+					while (!count && !stopped) emptycv.wait(guard);
+					if (!count) break;
+				}
+				BUFFER& buffer = buffers[head];
+				const bool error = fwrite(buffer.data, 1, buffer.size, file) != buffer.size;
+				std::unique_lock<std::mutex> guard(lock);
+				if (error) failed.store(true, std::memory_order_release);
+				head = (head + 1) % nbuffers;
+				count--;
+				fullcv.notify_one();
+			}
+		}
+
+	public:
+		PROOFSINK() :
+			buffers(NULL)
+			, writer(NULL)
+			, file(NULL)
+			, cap(0)
+			, nbytes(0)
+			, nstalls(0)
+			, stalltime(0)
+			, nbuffers(0)
+			, head(0)
+			, count(0)
+			, tail(0)
+			, stopped(false)
+			, failed(false)
+		{}
+		~PROOFSINK() { close(0); }
+		inline bool		active		() const { return writer != NULL; }
+		inline bool		error		() const { return failed.load(std::memory_order_acquire); }
+		inline uint64	bytes		() const { return nbytes; } // handed to the writer
+		inline uint64	stalls		() const { return nstalls; }
+		inline double	stallTime	() const { return stalltime; }
+		inline size_t	capacity	() const { return cap; }
+		// returns the first buffer to be filled
+		inline Byte*	open		(FILE* _file, const size_t& _cap, const uint32& _nbuffers) {
+			assert(writer == NULL);
+			assert(_file != NULL);
+			assert(_cap && _nbuffers > 1);
+			file = _file, cap = _cap, nbuffers = _nbuffers;
+			buffers = pfmalloc<BUFFER>(nbuffers);
+			for (uint32 i = 0; i < nbuffers; i++) {
+				buffers[i].data = pfmalloc<Byte>(cap);
+				buffers[i].size = 0;
+			}
+			head = count = tail = 0;
+			stopped = false;
+			failed.store(false, std::memory_order_relaxed);
+			writer = new std::thread(&PROOFSINK::flush, this);
+			return buffers[tail].data;
+		}
+		// hands 'size' bytes of the current buffer to the writer and
+		// returns the next free buffer, waiting if none is available
+		inline Byte*	submit		(const size_t& size) {
+			assert(writer != NULL);
+			assert(size <= cap);
+			std::unique_lock<std::mutex> guard(lock);
+			buffers[tail].size = size;
+			tail = (tail + 1) % nbuffers;
+			nbytes += size;
+			count++;
+			emptycv.notify_one();
+			if (count == nbuffers) {
+				const auto start = std::chrono::steady_clock::now();
+				while (count == nbuffers) fullcv.wait(guard);
+				stalltime += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+				nstalls++;
+			}
+			return buffers[tail].data;
+		}
+		// flushes the last 'size' bytes of the current buffer and stops the writer
+		inline void		close		(const size_t& size) {
+			if (writer == NULL) return;
+			{
+				std::unique_lock<std::mutex> guard(lock);
+				if (size) {
+					assert(count < nbuffers);
+					buffers[tail].size = size;
+					tail = (tail + 1) % nbuffers;
+					nbytes += size;
+					count++;
+				}
+				stopped = true;
+				emptycv.notify_one();
+			}
+			writer->join();
+			delete writer;
+			writer = NULL;
+			for (uint32 i = 0; i < nbuffers; i++) std::free(buffers[i].data);
+			std::free(buffers);
+			buffers = NULL;
+			file = NULL;
+		}
+	};
+
+}
+
+#endif
@@ -0,0 +1,227 @@
+/***********************************************************************[snapshot.cpp]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#include "solve.h"
+#include "snapshot.h"
+#include "control.h"
+
+using namespace pFROST;
+
+inline void writeSection(FILE* file, const void* data, const uint64& bytes)
+{
+	static const Byte padding[8] = { 0 };
+	if (bytes && fwrite(data, 1, bytes, file) != bytes) PFLOGE("cannot write snapshot section");
+	const uint64 pad = SNAPSHOT_ALIGN(bytes) - bytes;
+	if (pad && fwrite(padding, 1, pad, file) != pad) PFLOGE("cannot write snapshot padding");
+}
+
+template <class T>
+inline const T* readSection(addr_t& pos, const addr_t eof, const uint64& n)
+{
+	const uint64 bytes = n * sizeof(T);
+	if (pos + SNAPSHOT_ALIGN(bytes) > eof) PFLOGE("snapshot is truncated");
+	const T* data = (const T*)pos;
+	pos += SNAPSHOT_ALIGN(bytes);
+	return data;
+}
+
+void ParaFROST::writeSnapshot()
+{
+	assert(!DL());
+	assert(conflict == NOREF);
+	assert(UNSOLVED(cnfstate));
+	assert(sp->propagated == trail.size());
+	if (cm.garbage()) {
+		const bool gens[GENERATIONS] = { true, true };
+		CMM new_cm;
+		new_cm.target(cm, gens);
+		recycle(new_cm);
+		new_cm.migrateTo(cm);
+	}
+	PFLOGN2(1, " Writing snapshot to \"%s%s%s\"..", CREPORTVAL, opts.snapshot_path, CNORMAL);
+	FILE* file = fopen(opts.snapshot_path, "wb");
+	if (file == NULL) PFLOGE("cannot open snapshot file %s", opts.snapshot_path);
+	SNAPHEADER header;
+	memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+	header.version = SNAPSHOT_VERSION;
+	header.endian = SNAPSHOT_ENDIAN;
+	header.crefbytes = sizeof(C_REF);
+	header.clausebytes = sizeof(CLAUSE);
+	header.splayout = SP_LAYOUT;
+	header.info = inf;
+	header.stats = stats;
+	header.last = last;
+	header.sleep = sleep;
+	header.bumped = bumped;
+	header.propagated = sp->propagated;
+	header.simplified = sp->simplified;
+	header.trailpivot = sp->trailpivot;
+	header.modelvars = model.maxVar;
+	header.units = formula.units;
+	header.large = formula.large;
+	header.binaries = formula.binaries;
+	header.ternaries = formula.ternaries;
+	header.maxClauseSize = formula.maxClauseSize;
+	header.sigmified = stats.sigma.calls > 0;
+	header.arena = cm.size(0);
+	header.learntarena = cm.size(1);
+	header.orgs = orgs.size();
+	header.learnts = learnts.size();
+	header.trail = trail.size();
+	header.vorg = vorg.size();
+	header.lits = model.lits.size();
+	header.resolved = model.resolved.size();
+	header.space = sp->capacity();
+	uVec1D queue;
+	queue.reserve(inf.maxVar);
+	for (uint32 q = vmtf.first(); q; q = vmtf.next(q)) queue.push(q);
+	header.queue = queue.size();
+	assert(bumps.size() == inf.maxVar + 1);
+	assert(activity.size() == inf.maxVar + 1);
+	writeSection(file, &header, sizeof(SNAPHEADER));
+	writeSection(file, cm.size(0) ? cm.address(0) : NULL, header.arena * cm.bucket());
+	writeSection(file, cm.size(1) ? cm.address(LEARNTGEN) : NULL, header.learntarena * cm.bucket());
+	writeSection(file, orgs.data(), header.orgs * sizeof(C_REF));
+	writeSection(file, learnts.data(), header.learnts * sizeof(C_REF));
+	writeSection(file, trail.data(), header.trail * sizeof(uint32));
+	writeSection(file, vorg.data(), header.vorg * sizeof(uint32));
+	writeSection(file, model.lits.data(), header.lits * sizeof(uint32));
+	writeSection(file, model.resolved.data(), header.resolved * sizeof(uint32));
+	writeSection(file, sp->data(), header.space);
+	writeSection(file, queue.data(), header.queue * sizeof(uint32));
+	writeSection(file, bumps.data(), bumps.size() * sizeof(uint64));
+	writeSection(file, activity.data(), activity.size() * sizeof(double));
+	const long bytes = ftell(file);
+	if (fclose(file)) PFLOGE("cannot close snapshot file %s", opts.snapshot_path);
+	queue.clear(true);
+	PFLENDING(1, 5, "(%.2f MB written)", double(bytes) / MBYTE);
+}
+
+bool ParaFROST::readSnapshot(const uint64& fsz)
+{
+	if (opts.proof_en) PFLOGE("cannot continue a proof from a snapshot");
+	if (opts.parseincr_en) PFLOGE("incremental parsing of a snapshot is not supported");
+	PFLOG2(1, " Restoring snapshot \"%s%s%s\" (size: %s%lld MB%s)",
+		CREPORTVAL, formula.path.c_str(), CNORMAL, CREPORTVAL, ratio(fsz, uint64(MBYTE)), CNORMAL);
+	timer.start();
+	if (fsz < sizeof(SNAPHEADER)) PFLOGE("snapshot is truncated");
+#if defined(__linux__) || defined(__CYGWIN__)
+	int fd = open(formula.path.c_str(), O_RDONLY, 0);
+	if (fd == -1) PFLOGE("cannot open snapshot file");
+	void* buffer = mmap(NULL, fsz, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (buffer == MAP_FAILED) PFLOGE("cannot map snapshot file");
+	addr_t pos = (addr_t)buffer;
+#else
+	ifstream inputFile;
+	inputFile.open(formula.path, ifstream::in | ifstream::binary);
+	if (!inputFile.is_open()) PFLOGE("cannot open snapshot file");
+	addr_t buffer = pfcalloc<Byte>(fsz), pos = buffer;
+	inputFile.read((char*)buffer, fsz);
+#endif
+	const addr_t eof = pos + fsz;
+	const SNAPHEADER& header = *readSection<SNAPHEADER>(pos, eof, 1);
+	if (!header.valid()) PFLOGE("snapshot has wrong format");
+	if (header.version == SNAPSHOT_VERSION && header.splayout != SP_LAYOUT)
+		PFLOGE("snapshot search space was written with %s layout but this build uses %s",
+			header.splayout ? "interleaved (HOTVARS)" : "separate arrays", SP_LAYOUTNAME);
+	if (!header.compatible()) PFLOGE("snapshot version %d is not compatible with this build", header.version);
+	// restore counters
+	inf = header.info;
+	const uint64 sysmem = stats.sysmem;
+	stats = header.stats;
+	stats.sysmem = sysmem;
+	last = header.last;
+	sleep = header.sleep;
+	bumped = header.bumped;
+	formula.units = header.units;
+	formula.large = header.large;
+	formula.binaries = header.binaries;
+	formula.ternaries = header.ternaries;
+	formula.maxClauseSize = header.maxClauseSize;
+	formula.sigmified = header.sigmified;
+	formula.restored = true;
+	formula.size = fsz;
+	const uint32 maxSize = inf.maxVar + 1;
+	if (!inf.maxVar || inf.nDualVars != V2L(maxSize)) PFLOGE("snapshot has corrupted variables");
+	if (header.vorg != maxSize) PFLOGE("snapshot has corrupted variable mapping");
+	// restore clause arena and references
+	const uint32* arena = readSection<uint32>(pos, eof, header.arena);
+	const uint32* learntarena = readSection<uint32>(pos, eof, header.learntarena);
+	const C_REF* orefs = readSection<C_REF>(pos, eof, header.orgs);
+	const C_REF* lrefs = readSection<C_REF>(pos, eof, header.learnts);
+	const uint32* units = readSection<uint32>(pos, eof, header.trail);
+	const uint32* vorgs = readSection<uint32>(pos, eof, header.vorg);
+	const uint32* mlits = readSection<uint32>(pos, eof, header.lits);
+	const uint32* witness = readSection<uint32>(pos, eof, header.resolved);
+	const Byte* space = readSection<Byte>(pos, eof, header.space);
+	const uint32* queue = readSection<uint32>(pos, eof, header.queue);
+	const uint64* vbumps = readSection<uint64>(pos, eof, maxSize);
+	const double* vactivity = readSection<double>(pos, eof, maxSize);
+	cm.restore(0, arena, header.arena);
+	cm.restore(1, learntarena, header.learntarena);
+	orgs.resize(uint32(header.orgs));
+	if (header.orgs) memcpy(orgs.data(), orefs, header.orgs * sizeof(C_REF));
+	learnts.resize(uint32(header.learnts));
+	if (header.learnts) memcpy(learnts.data(), lrefs, header.learnts * sizeof(C_REF));
+	// restore search space
+	sp = new SP(maxSize);
+	if (sp->capacity() != header.space) PFLOGE("snapshot has corrupted search space");
+	memcpy(sp->data(), space, header.space);
+	sp->propagated = header.propagated;
+	sp->simplified = header.simplified;
+	sp->trailpivot = header.trailpivot;
+	trail.reserve(inf.maxVar);
+	trail.resize(uint32(header.trail));
+	if (header.trail) memcpy(trail.data(), units, header.trail * sizeof(uint32));
+	dlevels.reserve(inf.maxVar);
+	wt.resize(inf.nDualVars);
+	bumps.resize(maxSize), activity.resize(maxSize);
+	memcpy(bumps.data(), vbumps, maxSize * sizeof(uint64));
+	memcpy(activity.data(), vactivity, maxSize * sizeof(double));
+	// restore decision heuristics
+	for (uint64 i = 0; i < header.queue; i++) vmtf.init(queue[i]);
+	if (vmtf.last()) updateQueue();
+	initHeap();
+	// restore model mapping and witnesses
+	vorg.resize(maxSize);
+	memcpy(vorg.data(), vorgs, maxSize * sizeof(uint32));
+	model.maxVar = header.modelvars;
+	model.lits.resize(uint32(header.lits));
+	if (header.lits) memcpy(model.lits.data(), mlits, header.lits * sizeof(uint32));
+	model.resolved.resize(uint32(header.resolved));
+	if (header.resolved) memcpy(model.resolved.data(), witness, header.resolved * sizeof(uint32));
+	model.init(vorg);
+#if defined(__linux__) || defined(__CYGWIN__)
+	if (munmap(buffer, fsz) != 0) PFLOGE("cannot clean snapshot file %s mapping", formula.path.c_str());
+	close(fd);
+#else
+	free(buffer);
+	inputFile.close();
+#endif
+	rebuildWT(opts.sigma_priorbins);
+	timer.stop();
+	timer.parse = timer.cpuTime();
+	PFLOG2(1, " Restored %s%d Variables%s, %s%d Clauses%s, and %s%lld Literals%s in %s%.2f seconds%s",
+		CREPORTVAL, inf.maxVar, CNORMAL,
+		CREPORTVAL, orgs.size() + trail.size(), CNORMAL,
+		CREPORTVAL, stats.literals.original + trail.size(), CNORMAL,
+		CREPORTVAL, timer.parse, CNORMAL);
+	if (formula.sigmified) PFLOG2(1, "  snapshot was taken after %s%d sigmification(s)%s", CREPORTVAL, stats.sigma.calls, CNORMAL);
+	PFLMEMCALL(this, 2);
+	return true;
+}
@@ -0,0 +1,84 @@
+/***********************************************************************[snapshot.h]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#ifndef __SNAPSHOT_
+#define __SNAPSHOT_
+
+#include "clause.h"
+#include "limit.h"
+#include "statistics.h"
+#include "space.h"
+#include "definitions.h"
+
+namespace pFROST {
+
+	#define SNAPSHOT_MAGIC		"PFSNAP\r\n"
+	#define SNAPSHOT_VERSION	5
+	#define SNAPSHOT_ENDIAN		0x01020304U
+	#define SNAPSHOT_ALIGN(X)	(((X) + 7) & ~uint64(7))
+
+	/*****************************************************/
+	/*  Usage: header of a binary formula snapshot,      */
+	/*         followed by 8-byte aligned sections in    */
+	/*         the order of the section sizes below      */
+	/*****************************************************/
+	struct SNAPHEADER {
+		char		magic[8];
+		uint32		version, endian;
+		uint32		crefbytes, clausebytes, splayout;
+		CNF_INFO	info;
+		STATS		stats;
+		LAST		last;
+		SLEEP		sleep;
+		uint64		bumped;
+		uint32		propagated, simplified, trailpivot;
+		uint32		modelvars;
+		uint32		units, large, binaries, ternaries;
+		int			maxClauseSize;
+		bool		sigmified;
+		// sections
+		uint64		arena, learntarena, orgs, learnts, trail;
+		uint64		vorg, lits, resolved;
+		uint64		space, queue;
+		SNAPHEADER() { memset((void*)this, 0, sizeof(*this)); }
+		inline bool valid() const {
+			return !memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic));
+		}
+		inline bool compatible() const {
+			return version == SNAPSHOT_VERSION
+				&& endian == SNAPSHOT_ENDIAN
+				&& crefbytes == sizeof(C_REF)
+				&& clausebytes == sizeof(CLAUSE)
+				&& splayout == SP_LAYOUT;
+		}
+	};
+
+	// returns true if 'path' starts with the snapshot magic
+	inline bool isSnapshot(const char* path)
+	{
+		FILE* file = fopen(path, "rb");
+		if (file == NULL) return false;
+		char magic[8] = { 0 };
+		const size_t n = fread(magic, 1, sizeof(magic), file);
+		fclose(file);
+		return n == sizeof(magic) && !memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic));
+	}
+
+}
+
+#endif
@@ -45,8 +45,11 @@ ParaFROST::ParaFROST(const string& _path) :
 	getCPUInfo(stats.sysmem);
 	getBuildInfo();
 	initSolver();
-	if (!parser() || BCP()) { learnEmpty(), killSolver(); }
-	if (opts.parseonly_en) killSolver();
+	if (!parser() || (!incremental && BCP())) { learnEmpty(), killSolver(); }
+	if (opts.parseonly_en) {
+		if (opts.snapshot_en && UNSOLVED(cnfstate)) writeSnapshot();
+		killSolver();
+	}
 }
 
 void ParaFROST::allocSolver()
@@ -79,17 +82,32 @@ void ParaFROST::initSolver()
 	assert(UNSOLVED(cnfstate));
 	forceFPU();
 	opts.init();
+	pagepolicy().huge = opts.hugepages_en;
+	PFLOG2(1, " Searching long clauses with %s%s%s kernel", CREPORTVAL, simdName(initSIMD(opts.simd_en)), CNORMAL);
+	if (opts.perf_en) {
+		if (!perf.init()) PFLOGW("hardware performance counters are not available");
+		else {
+			for (int e = 0; e < PERF_EVENTS; e++)
+				if (!perf.available(PERF_EVENT(e))) PFLOG2(1, " Performance counter %s is not available", PERFCOUNTERS::name(PERF_EVENT(e)));
+		}
+	}
 	subbin.resize(2);
 	dlevels.push(0);
-	if (opts.proof_en) {
+	if (opts.lrat_en && opts.snapshot_en) { // clause identifiers would be stored in the arena
+		PFLOG2(1, "  Disabling snapshots with LRAT proofs");
+		opts.snapshot_en = false;
+	}
+	if (opts.proof_out_en) {
 #ifdef _WIN32
 		if (!opts.proof_nonbinary_en) {
 			PFLOG2(1, "  Disabling DRAT binary mode on Windows");
 			opts.proof_nonbinary_en = true;
 		}
 #endif
-		proof.handFile(opts.proof_path, opts.proof_nonbinary_en);
+		proof.handFile(opts.proof_path, opts.proof_nonbinary_en, opts.lrat_en);
+		proof.handSink(size_t(opts.proof_buffer) * MBYTE, opts.proof_buffers);
 	}
+	if (opts.proof_check_en) proof.handChecker();
 }
 
 void ParaFROST::initLimits() 
@@ -112,6 +130,11 @@ void ParaFROST::initLimits()
 	INIT_LIMIT(limit.probe, opts.probe_inc, true);
 	INIT_LIMIT(limit.sigma, opts.sigma_inc, true);
 	INIT_LIMIT(limit.subsume, opts.subsume_inc, true);
+	if (formula.sigmified) {
+		PFLOG2(2, "  Resuming sigma limit from snapshot");
+		INCREASE_LIMIT(sigma, stats.sigma.calls, nlognlogn, true);
+		last.sigma.reduces = stats.reduces + 1;
+	}
 	lbdrest.init(opts.lbd_rate, opts.lbd_fast, opts.lbd_slow);
 	lbdrest.reset();
 	stable = opts.stable_en && opts.vsidsonly_en;
@@ -137,10 +160,17 @@ void ParaFROST::initLimits()
 void ParaFROST::solve()
 {
 	FAULT_DETECTOR;
+	if (formula.icnf) return; // incremental calls are solved while parsing
+	if (incremental) { // '-parseincr' built the solver by adding variables on demand
+		Lits_t none;
+		isolve(none);
+		return;
+	}
 	timer.start();
 	initLimits();
 	if (verbose == 1) printTable();
 	if (canPreSigmify()) sigmify();
+	if (opts.snapshot_en && !formula.restored && UNSOLVED(cnfstate)) writeSnapshot();
 	if (UNSOLVED(cnfstate)) {
 		PFLOG2(2, "-- CDCL search started..");
 		MDMInit();
@@ -174,10 +204,15 @@ void ParaFROST::wrapup()
 		}
 		if (opts.modelverify_en) {
 			model.extend(sp->value);
-			model.verify(formula.path);
+			if (model.image.enabled()) model.verifyImage(opts.verify_threads);
+			else if (formula.streamed) PFLOGW("cannot re-read a streamed input to verify model (see --modelimage)");
+			else if (formula.restored) PFLOGW("cannot verify model on a snapshot input");
+			else if (formula.icnf) PFLOGW("cannot re-read an incremental input to verify model (see --modelimage)");
+			else model.verify(formula.path);
 		}
 	}
 	else if (cnfstate == UNSAT) PFLOGS("UNSATISFIABLE");
 	else if (UNSOLVED(cnfstate)) PFLOGS("UNKNOWN");
+	if (proof.checking()) proof.checkResult(cnfstate == UNSAT && iconflict.empty());
 	if (opts.report_en) report();
 }
\ No newline at end of file
@@ -35,6 +35,9 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "solvertypes.h"
 #include "simptypes.h"
 #include "dimacs.h"
+#include "dedup.h"
+#include "simd.h"
+#include "perf.h"
 
 namespace pFROST {
 	/*****************************************************/
@@ -53,9 +56,11 @@ namespace pFROST {
 		LIMIT			limit;
 		LAST			last;
 		STATS			stats;
+		PERFCOUNTERS	perf;
 		SLEEP			sleep;
 		BCNF			orgs, learnts, reduced;
 		VMAP			vmap;
+		DUPTABLE<C_REF>	parsedups;
 		Lits_t			learntC;
 		CLAUSE			subbin;
 		QUEUE			vmtf;
@@ -74,7 +79,7 @@ namespace pFROST {
 		uVec1D			dlevels;
 		uVec1D			trail;
 		uVec1D			vorg, vhist;
-		uVec1D			analyzed, minimized;
+		uVec1D			analyzed, minimized, chained;
 		LBDREST			lbdrest;
 		LUBYREST		lubyrest;
 		RANDOM			random;
@@ -96,7 +101,7 @@ namespace pFROST {
 		inline CL_ST	subsumeClause		(CLAUSE&, const C_REF&);
 		inline void		removeSubsumed		(CLAUSE&, const C_REF&, CLAUSE*);
 		inline void	    strengthenOTF		(CLAUSE&, const C_REF&, const uint32&);
-		inline void		strengthen			(CLAUSE&, const uint32&);
+		inline void		strengthen			(CLAUSE&, const C_REF&, const C_REF&, const uint32&);
 		inline LIT_ST	sortClause			(CLAUSE&, const int&, const int&, const bool&);
 		inline void		moveClause			(C_REF&, CMM&);
 		inline void		moveWatches			(WL&, CMM&);
@@ -108,12 +113,14 @@ namespace pFROST {
 		inline bool		findBinary			(uint32, uint32);
 		inline bool		findTernary			(uint32, uint32, uint32);
 		inline void		analyzeLit			(const uint32&, int&, int&);
+		inline void		chainReason			(const C_REF&, const uint32&, const uint64&);
 		inline uint32	analyzeReason		(const C_REF&, const uint32&);
 		inline bool		analyzeReason		(const C_REF&, const uint32&, int&);
 		inline bool		isBinary			(const C_REF&, uint32&, uint32&);
 		inline uint32	propAutarkClause	(const bool&, const C_REF&, CLAUSE&, const LIT_ST*, LIT_ST*);
 		inline bool		proplarge			(const uint32&, const bool&);
 		inline bool		propbinary			(const uint32&);
+		inline void		lookahead			(const WATCH*, const WATCH*, const LIT_ST*, const int&);
 		inline void		cancelAssign		(const uint32&);
 		inline void		cancelAutark		(const bool&, const uint32&, LIT_ST*);
 		inline void		pumpFrozenHeap		(const uint32&);
@@ -147,10 +154,10 @@ namespace pFROST {
 		inline bool		useTarget			() const { return (stable && opts.targetphase_en) || opts.targetonly_en; }
 		inline bool		vsidsOnly			() const { return (stable && opts.vsidsonly_en); }
 		inline bool		vsidsEnabled		() const { return (stable && opts.vsids_en); }
-		inline bool		canPreSigmify		() const { return opts.sigma_en; }
+		inline bool		canPreSigmify		() const { return opts.sigma_en && !formula.sigmified; }
 		inline bool		canRephase			() const { return opts.rephase_en && stats.conflicts > limit.rephase; }
 		inline bool		canReduce			() const { return opts.reduce_en && stats.clauses.learnt && stats.conflicts >= limit.reduce; }
-		inline bool		canCollect			() const { return cm.garbage() > (cm.size() * opts.gc_perc); }
+		inline bool		canCollect			() const { return cm.collectable(0, opts.gc_perc) || cm.collectable(1, opts.gc_perc); }
 		inline bool		canProbe			() const {
 			if (!opts.probe_en) return false;
 			if (last.probe.reduces > stats.reduces) return false;
@@ -178,6 +185,7 @@ namespace pFROST {
 		inline bool		canMMD				() 
 		{
 			if (!opts.mdm_rounds) return false;
+			if (!opts.mdmassume_en && DL() < assumptions.size()) return false;
 			assert(trail.size() <= inf.maxVar); 
 			const bool enough = (inf.maxVar - trail.size()) > last.mdm.unassigned;
 			const bool rounds = last.mdm.rounds;
@@ -235,7 +243,11 @@ namespace pFROST {
 			PFLOGN2(2, " Initializing original variables array with %d variables..", inf.maxVar);
 			vorg.resize(inf.maxVar + 1);
 			vorg[0] = 0;
-			forall_variables(v) { vorg[v] = v; }
+			if (formula.compacted) {
+				for (uint32 v = 1; v <= model.maxVar; v++)
+					if (model.lits[v]) vorg[ABS(model.lits[v])] = v;
+			}
+			else forall_variables(v) { vorg[v] = v; }
 			PFLDONE(2, 5);
 		}
 		inline void		updateQueue			() {
@@ -249,7 +261,10 @@ namespace pFROST {
 			}
 		}
 		inline void		learnEmpty			() {
-			if (opts.proof_en) proof.addEmpty();
+			if (opts.proof_en) {
+				if (proof.lrat() && conflict != NOREF) chainConflict(conflict);
+				proof.addEmpty();
+			}
 			cnfstate = UNSAT;
 		}
 		inline void		clearLevels			() {
@@ -288,7 +303,7 @@ namespace pFROST {
 		}
 		inline void		clearMDM			() {
 			assert(verifyMDM());
-			LIT_ST* seen = sp->seen;
+			SEENS seen = sp->seen;
 			for (uint32* i = trail + sp->propagated, *end = trail.end(); i != end; ++i)
 				seen[ABS(*i)] = 0;
 
@@ -413,7 +428,7 @@ namespace pFROST {
 			trail.push(lit);
 			assert(inf.unassigned);
 			inf.unassigned--;
-			if (!level) learnUnit(lit, v);
+			if (!level) learnUnit(lit, v, src);
 #ifdef LOGGING
 			PFLNEWLIT(this, 4, src, lit);
 #endif
@@ -432,7 +447,7 @@ namespace pFROST {
 			assert(active(lit));
 			assert(!DL());
 			const uint32 v = ABS(lit);
-			learnUnit(lit, v);
+			learnUnit(lit, v, NOREF);
 			sp->level[v] = 0;
 			sp->value[lit] = 1;
 			sp->value[FLIP(lit)] = 0;
@@ -472,8 +487,11 @@ namespace pFROST {
 			}
 			return fl;
 		}
-		inline void		learnUnit			(const uint32& lit, const uint32& v) {
-			if (opts.proof_en) proof.addUnit(lit);
+		inline void		learnUnit			(const uint32& lit, const uint32& v, const C_REF& src) {
+			if (opts.proof_en) {
+				if (proof.lrat() && REASON(src)) chainUnit(lit, src);
+				proof.addUnit(lit);
+			}
 			assert(ABS(lit) == v);
 			markFrozen(v);
 		}
@@ -570,8 +588,19 @@ namespace pFROST {
 		C_REF	newClause			(const Lits_t&, const bool&);
 		void	newClause			(const C_REF&, CLAUSE&, const bool&);
 		bool	toClause			(Lits_t&, Lits_t&, char*&);
+		bool	toClause			(Lits_t&, Lits_t&);
+		bool	duplicate			(Lits_t&, const uint64&);
+		bool	parseChunks			(char*&, char*, Lits_t&, Lits_t&);
+		bool	parseStream			(const char*, Lits_t&, Lits_t&);
+		void	parseICNF			(char*&, char*, Lits_t&, Lits_t&);
+		bool	toClauses			(PARSECHUNK&, Lits_t&, Lits_t&, bool&);
+		void	parseHeader			(char*&, char*);
+		void	compactVars			(char*, char*);
+		bool	readSnapshot		(const uint64&);
+		void	writeSnapshot		();
 		void	backtrack			(const int& jmplevel = 0);
 		void	recycle				(CMM&);
+		void	slide				(const bool*);
 		void	filter				(BCNF&, CMM&);
 		void	filter				(BCNF&);
 		void	shrink				(BCNF&);
@@ -584,7 +613,7 @@ namespace pFROST {
 		void	attachBins			(BCNF&, const bool& hasElim = false);
 		void	attachNonBins		(BCNF&, const bool& hasElim = false);
 		void	attachClauses		(BCNF&, const bool& hasElim = false);
-		bool	substitute			(BCNF&, uint32*);
+		bool	substitute			(BCNF&, uint32*, const C_REF*);
 		void	attachTernary		(BCNF&, LIT_ST*);
 		void	scheduleTernary		(LIT_ST*);
 		uint32	autarkReasoning		(LIT_ST*);
@@ -596,6 +625,14 @@ namespace pFROST {
 		void	ternaryResolve		(const uint32&, const uint64&);
 		void	subsumeLearnt		(const C_REF&);
 		void	analyzeFailed		(const uint32&);
+		void	chainConflict		(const C_REF&, const uint32& implied = 0);
+		void	chainUnit			(const uint32&, const C_REF&);
+		void	chainLearnt			();
+		void	chainStrengthened	(CLAUSE&, const uint32&);
+		void	chainHyper			(const C_REF&, const uint32&, const uint32&);
+		bool	chainFailed			(const uint32&);
+		void	spanSCCs			(const uint32*, C_REF*);
+		void	chainSubstituted	(const C_REF&, const uint32*, const C_REF*);
 		uint32	makeAssign			(const uint32&, const bool& tphase = false);
 		bool	minimize			(const uint32&, const int& depth = 0);
 		void	rebuildWT			(const CL_ST& priorbins = 0);
@@ -661,6 +698,7 @@ namespace pFROST {
 		void	MDM					();
 		void	decide				();
 		void	report				();
+		void	reportPerf			();
 		void	wrapup				();
 		bool	parser				();
 		void	solve				();
@@ -675,6 +713,7 @@ namespace pFROST {
 	protected:
 		uVec1D	PVs;
 		SCNF	scnf;
+		SPOOL	spool;
 		OT		ot;
 		uint32	mu_inc;
 		bool	mapped;
@@ -785,7 +824,7 @@ namespace pFROST {
 			return (phase == opts.phases) || (lr <= opts.lits_min && phase > 2);
 		}
 		inline void		bumpShrunken		(SCLAUSE&);
-		inline void		newResolvent		(const Lits_t&);
+		inline void		newResolvent		(const Lits_t&, const S_REF&, const S_REF&);
 		inline void		xresolve			(const uint32&, Lits_t& out_c);
 		inline void		xsubstitute			(const uint32&, Lits_t& out_c);
 		inline bool		propClause			(const LIT_ST*, const uint32&, SCLAUSE&);
@@ -802,6 +841,7 @@ namespace pFROST {
 		bool			prop				();
 		void			bve					();
 		void			VE					();
+		uint64			dedup				();
 		void			SUB					();
 		void			ERE					();
 		void			BCE					();
@@ -811,10 +851,9 @@ namespace pFROST {
 		void			extract				(BCNF&);
 		void			createOT			(const bool& reset = true);
 		void			histSimp			(SCNF& cnf, const bool& reset = false);
-		void			strengthen			(SCLAUSE&, const uint32&);
+		void			strengthen			(SCLAUSE&, const uint32&, const S_REF&);
 		void			removeClause		(SCLAUSE&);
 		void			removeClause		(S_REF);
-		void			deleteClause		(S_REF&);
 		//==========================================//
 		//             Local search                 //
 		//==========================================//
@@ -840,7 +879,11 @@ namespace pFROST {
 	protected:
 		Vec<LIT_ST>		ifrozen, ivalue, imarks;
 		Vec<VSTATE>		ivstate;
+#if defined(HOTVARS)
+		Vec<HOTVAR>		ilevel;
+#else
 		Vec1D			ilevel;
+#endif
 		Lits_t			assumptions, iconflict;
 	public:
 						ParaFROST			();
@@ -848,6 +891,7 @@ namespace pFROST {
 		void			iallocSpace			();
 		uint32			iadd			    ();
 		void			idecide				();
+		void			isatisfied			();
 		void			ianalyze			(const uint32&);
 		bool			itoClause			(Lits_t&, Lits_t&);
 		void			iassume				(Lits_t&);
@@ -90,11 +90,11 @@ void ParaFROST::isolve(Lits_t& assumptions)
 		if (canPreSigmify()) sigmify();
 		if (UNSOLVED(cnfstate)) {
 			PFLOG2(2, "-- Incremental CDCL search started..");
-			MDMInit();
+			if (inf.unassigned) MDMInit();
 			while (UNSOLVED(cnfstate) && !interrupted()) {
 				PFLDL(this, 3);
 				if (BCP()) analyze();
-				else if (!inf.unassigned) cnfstate = SAT;
+				else if (!inf.unassigned) isatisfied();
 				else if (canReduce()) reduce();
 				else if (canRestart()) restart();
 				else if (canRephase()) rephase();
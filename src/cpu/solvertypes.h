@@ -21,14 +21,15 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "space.h"
 #include "watch.h"
+#include "lists.h"
 
 namespace pFROST {
 	
 	typedef Vec<C_REF> BCNF;
-	typedef Vec<WATCH, int> WL;
-	typedef Vec<WL> WT;
-	typedef Vec<uint32, int> BOL;
-	typedef Vec<C_REF, int> WOL;
+	typedef SVec<WATCH> WL;
+	typedef LISTS<WATCH> WT;
+	typedef SVec<uint32> BOL;
+	typedef SVec<C_REF> WOL;
 	
 	struct CSIZE {
 		C_REF ref;
@@ -23,6 +23,7 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "pdqsort.h"
 #include "wolfsort.h"
 #include "radixsort.h"
+#include "lists.h"
 
 namespace pFROST {
 
@@ -108,6 +109,20 @@ namespace pFROST {
 		assert(isSorted(d.data(), size, cmp));
 	}
 
+	template<class T, class CMP>
+	void Sort(SVec<T>& d, CMP cmp)
+	{
+		const int size = d.size();
+		T* data = d.data();
+		if (!size) return;
+		assert(data != NULL);
+		if (size <= INSORT_THR)
+			insertionSort(data, size, cmp);
+		else
+			std::sort(data, data + size, cmp);
+		assert(isSorted(d.data(), size, cmp));
+	}
+
 	template<class T, class SZ>
 	void rSort(T* d, const SZ& sz) {
 		assert(d != NULL);
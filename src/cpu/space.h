@@ -24,6 +24,49 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 #include "vstate.h"
 
 namespace pFROST {
+
+#if defined(HOTVARS)
+	/*****************************************************/
+	/*  Usage:    per-variable record of the fields that */
+	/*            conflict analysis reads together       */
+	/*  Dependency: none                                 */
+	/*****************************************************/
+	struct HOTVAR {
+		C_REF source;
+		int level;
+		LIT_ST seen;
+		HOTVAR(const int& lvl = UNDEFINED) : source(NOREF), level(lvl), seen(0) {}
+	};
+	/*****************************************************/
+	/*  Usage:    strided view of one HOTVAR field that  */
+	/*            indexes like the plain array it        */
+	/*            replaces                               */
+	/*  Dependency: HOTVAR                               */
+	/*****************************************************/
+	template <class T, size_t FIELD>
+	class HOTVIEW {
+		addr_t _base;
+	public:
+		HOTVIEW() = default;
+		HOTVIEW(HOTVAR* vars) : _base(vars == NULL ? NULL : addr_t(vars) + FIELD) {}
+		inline T& operator[] (const uint32& v) const {
+			assert(_base != NULL);
+			return *(T*)(_base + size_t(v) * sizeof(HOTVAR));
+		}
+	};
+	typedef HOTVIEW<int, offsetof(HOTVAR, level)> LEVELS;
+	typedef HOTVIEW<C_REF, offsetof(HOTVAR, source)> SOURCES;
+	typedef HOTVIEW<LIT_ST, offsetof(HOTVAR, seen)> SEENS;
+	#define SP_LAYOUT		1
+	#define SP_LAYOUTNAME	"interleaved (HOTVARS)"
+#else
+	typedef int* LEVELS;
+	typedef C_REF* SOURCES;
+	typedef LIT_ST* SEENS;
+	#define SP_LAYOUT		0
+	#define SP_LAYOUTNAME	"separate arrays"
+#endif
+
 	/*****************************************************/
 	/*  Usage:    Information of search space            */
 	/*  Dependency: none                                 */
@@ -42,12 +85,13 @@ namespace pFROST {
 						PUTCH('\n'); PFLOGN0("\t\t"); }
 	public:
 		// arrays
-		int* level;
+		LEVELS level;
+		SOURCES source;
+		SEENS seen;
 		uint32* tmpstack, *stacktail;
 		uint64* board;
-		C_REF* source;
 		VSTATE* vstate;
-		LIT_ST* seen, * frozen, * marks;
+		LIT_ST* frozen, * marks;
 		LIT_ST* value, * psaved, * ptarget, * pbest;
 		// scalers
 		int learntLBD;
@@ -61,28 +105,47 @@ namespace pFROST {
 		SP(const uint32& size) 
 		{
 			RESETSTRUCT(this);
-			assert(sizeof(C_REF) == sizeof(uint64));
 			assert(sizeof(VSTATE) == sizeof(Byte));
-			const size_t vec8Bytes = calcBytes<C_REF>(size, 2);
+			const size_t vec8Bytes = calcBytes<uint64>(size, 1);
+#if defined(HOTVARS)
+			const size_t vecHBytes = calcBytes<HOTVAR>(size, 1);
+			const size_t vec4Bytes = calcBytes<uint32>(size, 1);
+			const size_t vec1Bytes = calcBytes<LIT_ST>(size, 8);
+#else
+			const size_t vecHBytes = calcBytes<C_REF>(size, 1);
 			const size_t vec4Bytes = calcBytes<uint32>(size, 2);
 			const size_t vec1Bytes = calcBytes<LIT_ST>(size, 9);
+#endif
 			_sz = size;
-			_cap = vec1Bytes + vec4Bytes + vec8Bytes;
+			_cap = vec1Bytes + vec4Bytes + vecHBytes + vec8Bytes;
 			assert(_cap);
-			pfralloc(_mem, _cap);
+			pfarena(_mem, _cap);
 			assert(_mem != NULL);
 			memset(_mem, 0, _cap);
 			// 8-byte arrays
-			source = (C_REF*)_mem;
-			board = (uint64*)(source + _sz);
+			board = (uint64*)_mem;
+#if defined(HOTVARS)
+			// analysis records (level, source, seen)
+			HOTVAR* hot = (HOTVAR*)(_mem + vec8Bytes);
+			level = hot, source = hot, seen = hot;
+			// 4-byte arrays
+			tmpstack = (uint32*)(_mem + vec8Bytes + vecHBytes);
+			// 1-byte arrays
+			value = (LIT_ST*)(_mem + vec8Bytes + vecHBytes + vec4Bytes);
+			frozen = value + _sz + _sz;
+			psaved = frozen + _sz;
+#else
+			// reference arrays (4 or 8 bytes)
+			source = (C_REF*)(_mem + vec8Bytes);
 			// 4-byte arrays
-			level = (int*)(_mem + vec8Bytes);
+			level = (int*)(_mem + vec8Bytes + vecHBytes);
 			tmpstack = (uint32*)(level + _sz);
 			// 1-byte arrays
-			value = (LIT_ST*)(_mem + vec8Bytes + vec4Bytes);
+			value = (LIT_ST*)(_mem + vec8Bytes + vecHBytes + vec4Bytes);
 			frozen = value + _sz + _sz;
 			seen = frozen + _sz;
 			psaved = seen + _sz;
+#endif
 			ptarget = psaved + _sz;
 			pbest = ptarget + _sz;
 			marks = pbest + _sz;
@@ -100,6 +163,7 @@ namespace pFROST {
 		}
 		size_t	size		() const { return _sz; }
 		size_t	capacity	() const { return _cap; }
+		addr_t	data		() const { return _mem; }
 		void	initSaved	(const LIT_ST& pol) {
 			memset(psaved, pol, _sz);
 		}
@@ -67,6 +67,25 @@ void ParaFROST::report()
 		PFLOG1("\t\t\t%sSolver Report%s", CREPORT, CNORMAL);
 		PFLOG1(" %sSolver time            : %s%-16.3f  sec%s", CREPORT, CREPORTVAL, timer.solve, CNORMAL);
 		PFLOG1(" %sSystem memory          : %s%-16.3f  MB%s", CREPORT, CREPORTVAL, ratio(double(sysMemUsed()), double(MBYTE)), CNORMAL);
+		if (opts.hugepages_en) {
+			PFLOG1(" %s Huge pages advised    : %s%-16.3f  MB%s", CREPORT, CREPORTVAL, ratio(double(pagepolicy().advised), double(MBYTE)), CNORMAL);
+			PFLOG1(" %s Huge pages backed     : %s%-16.3f  MB%s", CREPORT, CREPORTVAL, ratio(double(sysHugeMemUsed()), double(MBYTE)), CNORMAL);
+		}
+		if (perf.available(PERF_DTLBMISSES) && perf.available(PERF_INSTRUCTIONS)) {
+			// misses per kilo-instruction to compare runs with and without huge pages
+			const char* pages = opts.hugepages_en ? "huge pages" : "base pages";
+			PFLOG1(" %s dTLB misses per Kinst : %s%-16.3f  (%s)%s", CREPORT, CREPORTVAL,
+				ratio(double(perf.total(PERF_DTLBMISSES)) * 1000.0, double(perf.total(PERF_INSTRUCTIONS))), pages, CNORMAL);
+			PFLOG1(" %s  in BCP               : %s%-16.3f  (%s)%s", CREPORT, CREPORTVAL,
+				ratio(double(perf.count(PERF_BCP, PERF_DTLBMISSES)) * 1000.0, double(perf.count(PERF_BCP, PERF_INSTRUCTIONS))), pages, CNORMAL);
+		}
+		PFLOG1(" %s Watch compactions     : %s%-16zd%s", CREPORT, CREPORTVAL, wt.compactions(), CNORMAL);
+		PFLOG1(" %s Watch reclaimed       : %s%-16.3f  MB%s", CREPORT, CREPORTVAL, ratio(double(wt.reclaimed()), double(MBYTE)), CNORMAL);
+		if (ot.compactions()) {
+			PFLOG1(" %s Occurs compactions    : %s%-16zd%s", CREPORT, CREPORTVAL, ot.compactions(), CNORMAL);
+			PFLOG1(" %s Occurs reclaimed      : %s%-16.3f  MB%s", CREPORT, CREPORTVAL, ratio(double(ot.reclaimed()), double(MBYTE)), CNORMAL);
+			PFLOG1(" %s Clause pool reclaimed : %s%-16.3f  MB%s", CREPORT, CREPORTVAL, ratio(double(spool.reclaimed()), double(MBYTE)), CNORMAL);
+		}
 		PFLOG1(" %sFormula                : %s%-s%s", CREPORT, CREPORTVAL, formula.path.c_str(), CNORMAL);
 		PFLOG1(" %s Size                  : %s%-16.3f  MB%s", CREPORT, CREPORTVAL, ratio(double(formula.size), double(MBYTE)), CNORMAL);
 		PFLOG1(" %s Units                 : %s%-10d%s", CREPORT, CREPORTVAL, formula.units, CNORMAL);
@@ -76,7 +95,21 @@ void ParaFROST::report()
 		PFLOG1(" %s Max clause size       : %s%-10d%s", CREPORT, CREPORTVAL, formula.maxClauseSize, CNORMAL);
 		PFLOG1(" %s C2V ratio             : %s%-10.3f%s", CREPORT, CREPORTVAL, formula.c2v, CNORMAL);
 		if (opts.proof_en)
+		{
 			PFLOG1(" %s Proof lines           : %s%-16zd%s", CREPORT, CREPORTVAL, proof.numClauses(), CNORMAL);
+			if (proof.async()) {
+				PFLOG1(" %s Proof size            : %s%-16.3f  MB%s", CREPORT, CREPORTVAL, ratio(double(proof.bytes()), double(MBYTE)), CNORMAL);
+				PFLOG1(" %s Proof stalls          : %s%-16lld%s", CREPORT, CREPORTVAL, proof.stalls(), CNORMAL);
+				PFLOG1(" %s Proof stall time      : %s%-16.3f  sec%s", CREPORT, CREPORTVAL, proof.stallTime(), CNORMAL);
+			}
+			if (proof.checking()) {
+				PROOFCHECKER& checker = proof.online();
+				PFLOG1(" %s Checked lemmas        : %s%-16lld%s", CREPORT, CREPORTVAL, checker.lemmas(), CNORMAL);
+				PFLOG1(" %s Checked deletions     : %s%-16lld%s", CREPORT, CREPORTVAL, checker.deleted(), CNORMAL);
+				PFLOG1(" %s Checker stalls        : %s%-16lld%s", CREPORT, CREPORTVAL, checker.stalls(), CNORMAL);
+				PFLOG1(" %s Checker stall time    : %s%-16.3f  sec%s", CREPORT, CREPORTVAL, checker.stallTime(), CNORMAL);
+			}
+		}
 		PFLOG1(" %sAutarky calls          : %s%-16lld%s", CREPORT, CREPORTVAL, stats.autarky.calls, CNORMAL);
 		PFLOG1(" %s Removed variables     : %s%-16lld%s", CREPORT, CREPORTVAL, stats.autarky.eliminated, CNORMAL);
 		PFLOG1(" %sBacktracks             : %s%-16lld%s", CREPORT, CREPORTVAL, stats.backtrack.chrono + stats.backtrack.nonchrono, CNORMAL);
@@ -96,6 +129,10 @@ void ParaFROST::report()
 		PFLOG1(" %sDeduplications         : %s%-16lld%s", CREPORT, CREPORTVAL, stats.debinary.calls, CNORMAL);
 		PFLOG1(" %s Hyper unaries         : %s%-16lld%s", CREPORT, CREPORTVAL, stats.debinary.hyperunary, CNORMAL);
 		PFLOG1(" %s Duplicated binaries   : %s%-16lld%s", CREPORT, CREPORTVAL, stats.debinary.binaries, CNORMAL);
+		PFLOG1(" %sDuplicated clauses     : %s%-16lld%s", CREPORT, CREPORTVAL, stats.duplicates.parsed + stats.duplicates.resolved + stats.duplicates.rebuilt, CNORMAL);
+		PFLOG1(" %s Parsed                : %s%-16lld%s", CREPORT, CREPORTVAL, stats.duplicates.parsed, CNORMAL);
+		PFLOG1(" %s Resolved              : %s%-16lld%s", CREPORT, CREPORTVAL, stats.duplicates.resolved, CNORMAL);
+		PFLOG1(" %s Rebuilt               : %s%-16lld%s", CREPORT, CREPORTVAL, stats.duplicates.rebuilt, CNORMAL);
 		PFLOG1(" %sDecompositions         : %s%-16lld%s", CREPORT, CREPORTVAL, stats.decompose.calls, CNORMAL);
 		PFLOG1(" %s SCCs                  : %s%-16lld%s", CREPORT, CREPORTVAL, stats.decompose.scc, CNORMAL);
 		PFLOG1(" %s Hyper unaries         : %s%-16lld%s", CREPORT, CREPORTVAL, stats.decompose.hyperunary, CNORMAL);
@@ -128,6 +165,7 @@ void ParaFROST::report()
 		PFLOG1(" %sRecyclings             : %s%-16lld%s", CREPORT, CREPORTVAL, stats.recycle.soft + stats.recycle.hard, CNORMAL);
 		PFLOG1(" %s Soft                  : %s%-16lld%s", CREPORT, CREPORTVAL, stats.recycle.soft, CNORMAL);
 		PFLOG1(" %s Hard                  : %s%-16lld%s", CREPORT, CREPORTVAL, stats.recycle.hard, CNORMAL);
+		PFLOG1(" %s  Learnts only         : %s%-16lld%s", CREPORT, CREPORTVAL, stats.recycle.learnt, CNORMAL);
 		PFLOG1(" %sProbes calls           : %s%-16lld%s", CREPORT, CREPORTVAL, stats.probe.calls, CNORMAL);
 		PFLOG1(" %s Rounds                : %s%-16lld%s", CREPORT, CREPORTVAL, stats.probe.rounds, CNORMAL);
 		PFLOG1(" %s Probed                : %s%-16lld%s", CREPORT, CREPORTVAL, stats.probe.probed, CNORMAL);
@@ -172,5 +210,32 @@ void ParaFROST::report()
 		PFLOG1(" %s Minimum               : %s%-16lld%s", CREPORT, CREPORTVAL, stats.walk.minimum, CNORMAL);
 		PFLOG1(" %s Flipped               : %s%-16lld%s", CREPORT, CREPORTVAL, stats.walk.flipped, CNORMAL);
 		PFLOG1(" %s Improved              : %s%-16lld%s", CREPORT, CREPORTVAL, stats.walk.improved, CNORMAL);
+		if (perf.enabled()) reportPerf();
+	}
+}
+
+void ParaFROST::reportPerf()
+{
+	PFLOG1("\t\t\t%sPerformance Counters%s", CREPORT, CNORMAL);
+	char line[256];
+	int n = 0;
+	for (int e = 0; e < PERF_EVENTS; e++) {
+		if (perf.available(PERF_EVENT(e)))
+			n += snprintf(line + n, sizeof(line) - n, "%-14s", PERFCOUNTERS::name(PERF_EVENT(e)));
+	}
+	PFLOG1(" %sPhase (millions, ms)   : %s%s%s", CREPORT, CREPORTVAL, line, CNORMAL);
+	for (int p = 0; p < PERF_PHASES; p++) {
+		bool counted = false;
+		n = 0;
+		for (int e = 0; e < PERF_EVENTS; e++) {
+			if (!perf.available(PERF_EVENT(e))) continue;
+			const uint64 c = perf.count(p, PERF_EVENT(e));
+			if (c) counted = true;
+			n += snprintf(line + n, sizeof(line) - n, "%-14.3f", double(c) / 1e6);
+		}
+		if (!counted) continue;
+		PFLOG1(" %s %-22s: %s%s%s", CREPORT, PERFCOUNTERS::name(p), CREPORTVAL, line, CNORMAL);
+		perf.summary(line, sizeof(line), p);
+		PFLOG1(" %s  %-21s: %s%s%s", CREPORT, "rates", CREPORTVAL, line, CNORMAL);
 	}
 }
\ No newline at end of file
@@ -46,7 +46,7 @@ namespace pFROST {
 		uint64 subtried;
 		int64 shrunken;
 		struct { uint64 ticks; } mode;
-		struct { uint64 hard, soft; } recycle;
+		struct { uint64 hard, soft, learnt; } recycle;
 		struct { uint64 all, stable; } restart;
 		struct { uint64 before, after; } minimize;
 		struct { uint32 learnt, forced; } units;
@@ -58,6 +58,7 @@ namespace pFROST {
 		struct { uint32 calls, vmtf, vsids, walks; } mdm;
 		struct { uint64 single, multiple, massumed; } decisions;
 		struct { uint64 calls, binaries, hyperunary; } debinary;
+		struct { uint64 parsed, resolved, rebuilt; } duplicates;
 		struct { uint64 calls, rounds, failed, probed; } probe;
 		struct { uint64 resolutions, resolvents, reduced; } binary;
 		struct { uint64 all, random, best, inv, org, flip; } rephase;
@@ -0,0 +1,323 @@
+/***********************************************************************[stream.h]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#ifndef __STREAM_
+#define __STREAM_
+
+#include "dimacs.h"
+#include <atomic>
+#ifdef _WIN32
+#define popen _popen
+#define pclose _pclose
+#else
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace pFROST {
+
+	#define STREAM_BLOCK	(4 * MBYTE)
+	#define STREAM_BLOCKS	4
+
+	#define STREAM_MAGIC	6
+
+	// returns the decompression command of the leading 'n' bytes or NULL for plain text
+	inline const char* decompressor(const Byte* magic, const size_t& n)
+	{
+		if (n >= 2 && magic[0] == 0x1F && magic[1] == 0x8B) return "gzip -c -d";
+		if (n >= 3 && magic[0] == 'B' && magic[1] == 'Z' && magic[2] == 'h') return "bzip2 -c -d";
+		if (n >= 4 && magic[0] == 0x28 && magic[1] == 0xB5 && magic[2] == 0x2F && magic[3] == 0xFD) return "zstd -q -c -d";
+		if (n >= 6 && magic[0] == 0xFD && !memcmp(magic + 1, "7zXZ", 4) && magic[5] == 0) return "xz -c -d";
+		if (n >= 3 && magic[0] == 0x5D && magic[1] == 0 && magic[2] == 0) return "xz -c -d --format=lzma";
+		return NULL;
+	}
+
+	// returns the decompression command of a compressed file or NULL for plain text
+	inline const char* decompressor(const char* path)
+	{
+		FILE* file = fopen(path, "rb");
+		if (file == NULL) return NULL;
+		Byte magic[STREAM_MAGIC] = { 0 };
+		const size_t n = fread(magic, 1, STREAM_MAGIC, file);
+		fclose(file);
+		return decompressor(magic, n);
+	}
+
+	// returns the tool name of a decompression command
+	inline string decompressorTool(const char* command)
+	{
+		const char* space = strchr(command, ' ');
+		return space == NULL ? string(command) : string(command, space - command);
+	}
+
+	// checks that the tool of a decompression command is found on PATH
+	inline bool decompressorAvailable(const char* command)
+	{
+#ifdef _WIN32
+		return true;
+#else
+		const string tool = decompressorTool(command);
+		const char* path = getenv("PATH");
+		if (path == NULL) return false;
+		while (true) {
+			const char* colon = strchr(path, ':');
+			string dir = colon == NULL ? string(path) : string(path, colon - path);
+			if (dir.empty()) dir = ".";
+			if (!access((dir + "/" + tool).c_str(), X_OK)) return true;
+			if (colon == NULL) return false;
+			path = colon + 1;
+		}
+#endif
+	}
+
+	/*****************************************************/
+	/*  Usage: reads stdin, pipes or decompressor output */
+	/*         on a background thread into line-aligned  */
+	/*         blocks consumed by the parser             */
+	/*****************************************************/
+	class BLOCKREADER {
+		struct BLOCK {
+			char* data;
+			size_t size, cap;
+		} blocks[STREAM_BLOCKS];
+		std::mutex lock;
+		std::condition_variable fullcv, emptycv;
+		std::thread* reader;
+		FILE* file;
+		const char* sniffed;
+		Byte magic[STREAM_MAGIC];
+		size_t nmagic;
+		uint64 nbytes;
+		uint32 head, count;
+		int status;
+		std::atomic<bool> stopping;
+		bool piped, eof, consuming;
+
+		// reads the leading bytes of a stream without buffering beyond them
+		inline void sniff(const int& fd) {
+			nmagic = 0;
+#ifdef _WIN32
+			nmagic = fread(magic, 1, STREAM_MAGIC, file);
+#else
+			while (nmagic < STREAM_MAGIC) {
+				const ssize_t n = read(fd, magic + nmagic, STREAM_MAGIC - nmagic);
+				if (n <= 0) break;
+				nmagic += n;
+			}
+#endif
+			sniffed = decompressor(magic, nmagic);
+		}
+
+		// feeds the sniffed bytes and the rest of 'fd' to the decompressor
+		inline bool unpack(const int& fd) {
+#ifdef _WIN32
+			return false;
+#else
+			if (!decompressorAvailable(sniffed)) return false;
+			string cmd = "{ printf '";
+			char octal[8];
+			for (size_t i = 0; i < nmagic; i++) {
+				snprintf(octal, sizeof(octal), "\\%03o", magic[i]);
+				cmd += octal;
+			}
+			cmd += "'; cat; } | " + string(sniffed);
+			// the shell inherits 'fd' as its stdin
+			const int saved = fd == STDIN_FILENO ? -1 : dup(STDIN_FILENO);
+			if (saved >= 0) dup2(fd, STDIN_FILENO);
+			file = popen(cmd.c_str(), "r");
+			if (saved >= 0) dup2(saved, STDIN_FILENO), ::close(saved);
+			piped = true;
+			nmagic = 0;
+			return file != NULL;
+#endif
+		}
+
+		inline void fill() {
+			char* carry = NULL;
+			size_t carried = 0, carrycap = 0;
+			if (nmagic) {
+				// plain text whose first bytes were consumed while sniffing
+				carried = carrycap = nmagic;
+				pfralloc(carry, carrycap);
+				std::memcpy(carry, magic, nmagic);
+			}
+			uint32 tail = 0;
+			bool done = false;
+			while (!done) {
+				{
+					std::unique_lock<std::mutex> guard(lock);
+					while (count == STREAM_BLOCKS && !stopping) fullcv.wait(guard);
+				}
+				if (stopping) break;
+				BLOCK& block = blocks[tail];
+				if (block.cap < carried + STREAM_BLOCK + 1) {
+					block.cap = carried + STREAM_BLOCK + 1;
+					pfralloc(block.data, block.cap);
+				}
+				if (carried) std::memcpy(block.data, carry, carried);
+				size_t size = carried;
+				carried = 0;
+				// read until the block holds at least one complete line
+				while (true) {
+					if (size + STREAM_BLOCK + 1 > block.cap) {
+						block.cap = (size + STREAM_BLOCK + 1) << 1;
+						pfralloc(block.data, block.cap);
+					}
+					const size_t n = fread(block.data + size, 1, STREAM_BLOCK, file);
+					size += n;
+					if (n < STREAM_BLOCK) { done = true; break; }
+					if (stopping) break;
+					if (memchr(block.data + size - n, '\n', n)) break;
+				}
+				if (stopping) break;
+				if (!done) {
+					char* last = block.data + size;
+					while (last[-1] != '\n') last--;
+					carried = block.data + size - last;
+					if (carried > carrycap) {
+						carrycap = carried;
+						pfralloc(carry, carrycap);
+					}
+					std::memcpy(carry, last, carried);
+					size -= carried;
+				}
+				block.data[size] = '\0';
+				block.size = size;
+				tail = (tail + 1) % STREAM_BLOCKS;
+				std::unique_lock<std::mutex> guard(lock);
+				nbytes += size;
+				count++;
+				if (done) eof = true;
+				emptycv.notify_one();
+			}
+			if (carry != NULL) std::free(carry);
+		}
+
+	public:
+		BLOCKREADER() :
+			reader(NULL)
+			, file(NULL)
+			, sniffed(NULL)
+			, nmagic(0)
+			, nbytes(0)
+			, head(0)
+			, count(0)
+			, status(0)
+			, stopping(false)
+			, piped(false)
+			, eof(false)
+			, consuming(false)
+		{
+			for (uint32 i = 0; i < STREAM_BLOCKS; i++)
+				blocks[i].data = NULL, blocks[i].size = blocks[i].cap = 0;
+		}
+		~BLOCKREADER() { close(); }
+		// 'path' is read as is if 'command' is NULL, "-" denotes stdin;
+		// compressed data on stdin or a pipe is detected by its magic bytes
+		inline bool open(const string& path, const char* command) {
+			assert(file == NULL);
+			if (command != NULL) {
+				string cmd = string(command) + " '";
+				for (size_t i = 0; i < path.size(); i++) {
+					if (path[i] == '\'') cmd += "'\\''";
+					else cmd += path[i];
+				}
+				cmd += "'";
+				file = popen(cmd.c_str(), "r");
+				piped = true;
+			}
+			else {
+#ifdef _WIN32
+				file = path == "-" ? stdin : fopen(path.c_str(), "rb");
+				if (file == NULL) return false;
+				sniff(0);
+				if (sniffed != NULL) return false;
+#else
+				const int fd = path == "-" ? STDIN_FILENO : ::open(path.c_str(), O_RDONLY);
+				if (fd < 0) return false;
+				sniff(fd);
+				if (sniffed != NULL) {
+					const bool started = unpack(fd);
+					if (fd != STDIN_FILENO) ::close(fd);
+					if (!started) return false;
+				}
+				else if (fd == STDIN_FILENO) file = stdin;
+				else if ((file = fdopen(fd, "r")) == NULL) ::close(fd);
+#endif
+			}
+			if (file == NULL) return false;
+			reader = new std::thread(&BLOCKREADER::fill, this);
+			return true;
+		}
+		// exposes the next block in [str, eob), the previous one is released
+		inline bool next(char*& str, char*& eob) {
+			std::unique_lock<std::mutex> guard(lock);
+			if (consuming) {
+				head = (head + 1) % STREAM_BLOCKS;
+				count--;
+				consuming = false;
+				fullcv.notify_one();
+			}
+			while (!count && !eof) emptycv.wait(guard);
+			if (!count) return false;
+			consuming = true;
+			str = blocks[head].data, eob = str + blocks[head].size;
+			return true;
+		}
+		// returns the exit status of the decompressor, or 0 if
+		// the stream is closed before its end
+		inline int close() {
+			bool early = false;
+			if (reader != NULL) {
+				{
+					// stop the reader instead of draining the rest
+					std::unique_lock<std::mutex> guard(lock);
+					early = !eof;
+					stopping = true;
+					fullcv.notify_one();
+				}
+				reader->join();
+				delete reader;
+				reader = NULL;
+			}
+			if (file != NULL) {
+				if (piped) {
+					// an unfinished decompressor is ended by SIGPIPE
+					status = pclose(file);
+#ifndef _WIN32
+					if (status > 0 && WIFEXITED(status)) status = WEXITSTATUS(status);
+#endif
+					if (early) status = 0;
+				}
+				else if (file != stdin) fclose(file);
+				file = NULL;
+			}
+			for (uint32 i = 0; i < STREAM_BLOCKS; i++) {
+				if (blocks[i].data != NULL) std::free(blocks[i].data);
+				blocks[i].data = NULL, blocks[i].size = blocks[i].cap = 0;
+			}
+			return status;
+		}
+		inline uint64 bytes() const { return nbytes; }
+		// returns the decompression command detected on the stream or NULL
+		inline const char* compressed() const { return sniffed; }
+	};
+
+}
+
+#endif
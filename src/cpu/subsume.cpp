@@ -25,11 +25,14 @@ struct SUBSUME_RANK {
 	uint32 operator () (const CSIZE& a) const { return a.size; }
 };
 
-inline void ParaFROST::strengthen(CLAUSE& c, const uint32& self) {
+inline void ParaFROST::strengthen(CLAUSE& c, const C_REF& cref, const C_REF& sref, const uint32& self) {
 	CHECKLIT(self);
 	assert(c.size() > 2);
 	assert(unassigned(self));
-	if (opts.proof_en) proof.shrinkClause(c, self);
+	if (opts.proof_en) {
+		if (proof.lrat()) proof.hintClause(sref), proof.hintClause(cref);
+		proof.shrinkClause(cref, c, self);
+	}
 	uint32 *j = c;
 	forall_clause(c, i) {
 		const uint32 lit = *i;
@@ -91,6 +94,7 @@ inline CL_ST ParaFROST::subsumeClause(CLAUSE& c, const C_REF& cref)
 	assert(keeping(c));
 	markLits(c);   
 	CLAUSE* s = NULL;
+	C_REF sref = NOREF;
 	uint32 self = 0;
 	forall_clause(c, k) {
 		const uint32 lit = *k;
@@ -125,6 +129,7 @@ inline CL_ST ParaFROST::subsumeClause(CLAUSE& c, const C_REF& cref)
 				assert(d->size() <= c.size());
 				if (subsumeCheck(d, self)) {
 					s = d; // can be "original or learnt" 
+					sref = *i;
 					break;
 				}
 				else self = 0;
@@ -137,7 +142,7 @@ inline CL_ST ParaFROST::subsumeClause(CLAUSE& c, const C_REF& cref)
 	if (self) {
 		PFLCLAUSE(3, c, "  candidate ");
 		PFLCLAUSE(3, (*s), "  strengthened by ");
-		strengthen(c, FLIP(self));
+		strengthen(c, cref, sref, FLIP(self));
 		return -1;
 	}
 	else {
@@ -200,7 +205,7 @@ bool ParaFROST::subsumeAll()
 	radixSort(scheduled.data(), scheduled.end(), SUBSUME_RANK());
 	if (!stats.subsume.leftovers) {
 		forall_vector(CSIZE, scheduled, i) {
-			assert(i->ref < cm.size());
+			assert(cm.valid(i->ref));
 			CLAUSE& c = cm[i->ref];
 			if (c.size() > 2) c.markSubsume();
 		}
@@ -222,7 +227,8 @@ bool ParaFROST::subsumeAll()
 			if (st > 0) { subsumed++; continue; }
 			if (st < 0) { shrunken.push(r); strengthened++; }
 		}
-		bool subsume = true, orgbin = (c.binary() && c.original());
+		// LRAT hints need the references of strengthening binaries
+		bool subsume = true, orgbin = (c.binary() && c.original() && !proof.lrat());
 		uint32 minlit = 0, minhist = 0;
 		int minsize = 0;
 		forall_clause(c, k) {
@@ -132,7 +132,7 @@ inline bool selfsubsume(const uint32& x, const uint32& fx, OL& list, SCLAUSE& ca
 		if (subsuming.deleted()) continue;
 		if (subsize > 1 && selfsub(subsuming.sig(), candsig) && selfsub(x, fx, subsuming, cand)) {
 			PFLCLAUSE(4, cand, " Clause ");
-			pfrost->strengthen(cand, x);
+			pfrost->strengthen(cand, x, *j);
 			cand.melt(); // mark for fast recongnition in ot update 
 			PFLCLAUSE(4, subsuming, " Strengthened by ");
 			return true; // cannot strengthen "cand" anymore, 'x' already removed
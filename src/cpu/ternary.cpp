@@ -146,7 +146,10 @@ void ParaFROST::ternaryResolve(const uint32& p, const uint64& limit)
             if (neg.binary()) continue;
             stats.ternary.checks++;
             if (hyper3Resolve(*pos, neg, p)) {
-                if (opts.proof_en) proof.addClause(learntC);
+                if (opts.proof_en) {
+                    if (proof.lrat()) proof.hintClause(pref), proof.hintClause(nref);
+                    proof.addClause(learntC);
+                }
                 const int size = learntC.size();
                 bool learnt = false;
                 if (size == 3) {
@@ -93,7 +93,8 @@ void ParaFROST::transiting(const uint32& src, const uint64& limit, uint64& remov
 		if (failed) break;
 		if (stats.transitiveticks > limit) break;
 	}
-	if (failed) {
+	// LRAT hints are found by propagating the failed literal again
+	if (failed && (!proof.lrat() || chainFailed(src))) {
 		units++;
 		PFLOG2(4, "  found failed literal %d during transitive reduction", l2i(src));
 		enqueueUnit(FLIP(src));
@@ -136,7 +136,10 @@ inline void ParaFROST::strengthenOTF(CLAUSE& c, const C_REF& ref, const uint32&
 	c[0] = other, c[1] = self;
 	assert(c[0] != c[1]);
 	detachWatch(FLIP(self), ref);
-	if (opts.proof_en) proof.shrinkClause(c, self);
+	if (opts.proof_en) {
+		if (proof.lrat()) chainStrengthened(c, self);
+		proof.shrinkClause(ref, c, self);
+	}
 	uint32* j = c + 1, * end = c.end();
 	for (uint32* i = c + 2; i != end; i++) {
 		const uint32 lit = *i;
@@ -165,7 +168,7 @@ inline void ParaFROST::strengthenOTF(CLAUSE& c, const C_REF& ref, const uint32&
 	forall_watches(ws, i) {
 		if (i->ref == ref) {
 			i->imp = second;
-			i->size = size;
+			i->resize(size);
 			break;
 		}
 	}
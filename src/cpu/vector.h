@@ -36,7 +36,7 @@ namespace pFROST {
 	template<class T, class S = uint32>
 	class Vec {
 		T* _mem;
-		S sz, cap, maxCap;
+		S sz, cap;
 		bool check(const S& idx) const {
 			if (idx >= sz) {
 				SETCOLOR(CERROR, stderr);
@@ -49,13 +49,11 @@ namespace pFROST {
 		}
 	public:
 		__forceinline			~Vec		() { clear(true); }
-		__forceinline			Vec			() { maxCap = std::numeric_limits<S>::max(), _mem = NULL, sz = 0, cap = 0; }
+		__forceinline			Vec			() { _mem = NULL, sz = 0, cap = 0; }
 		__forceinline explicit	Vec			(const S& size) {
-			maxCap = std::numeric_limits<S>::max();
 			_mem = NULL, sz = 0, cap = 0; resize(size);
 		}
 		__forceinline			Vec			(const S& size, const T& val) {
-			maxCap = std::numeric_limits<S>::max();
 			_mem = NULL, sz = 0, cap = 0; resize(size, val);
 		}
 		__forceinline Vec<T>&	operator=	(Vec<T>& rhs) { return *this; }
@@ -110,7 +108,7 @@ namespace pFROST {
 		}
 		__forceinline void		reserve		(const S& min_cap) {
 			if (cap >= min_cap) return;
-			cap = (cap > (maxCap - cap)) ? min_cap : (cap << 1);
+			cap = (cap > (std::numeric_limits<S>::max() - cap)) ? min_cap : (cap << 1);
 			if (cap < min_cap) cap = min_cap;
 			pfralloc(_mem, sizeof(T) * cap);
 		}
@@ -132,8 +130,8 @@ namespace pFROST {
 		}
 		__forceinline void		migrateTo	(Vec<T, S>& dest) {
 			if (dest._mem != NULL) std::free(dest._mem);
-			dest._mem = _mem, dest.sz = sz, dest.cap = cap, dest.maxCap = maxCap;
-			_mem = NULL, sz = 0, cap = 0, maxCap = 0;
+			dest._mem = _mem, dest.sz = sz, dest.cap = cap;
+			_mem = NULL, sz = 0, cap = 0;
 		}
 		__forceinline void		clear		(const bool& _free = false) {
 			if (_mem != NULL) {
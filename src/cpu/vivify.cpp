@@ -73,9 +73,10 @@ bool ParaFROST::analyzeVivify(CLAUSE& cand, bool& original)
 	assert(DL());
 	CLAUSE& conf = cm[conflict];
 	bool conflictoriginality = conf.original();
-	int* levels = sp->level;
-	C_REF* sources = sp->source;
-	LIT_ST* values = sp->value, *seen = sp->seen;
+	LEVELS levels = sp->level;
+	SOURCES sources = sp->source;
+	LIT_ST* values = sp->value;
+	SEENS seen = sp->seen;
 	assert(conf.size() > 1);
 	PFLCLAUSE(4, conf, "  analyzing conflict");
 	forall_clause(conf, k) {
@@ -172,6 +173,8 @@ bool ParaFROST::learnVivify(CLAUSE& cand, const C_REF& cref, const int& nonFalse
 	PFLLEARNT(this, 3);
 	const int learntsize = learntC.size();
 	assert(learntsize <= nonFalse);
+	// chained before backtracking loses the conflict
+	if (learntsize < nonFalse && proof.lrat()) chainLearnt();
 	bool success;
 	if (learntsize == 1) {
 		PFLOG2(4, "  candidate is strengthened by a unit");
@@ -194,7 +197,8 @@ bool ParaFROST::learnVivify(CLAUSE& cand, const C_REF& cref, const int& nonFalse
 		if (opts.proof_en) proof.addClause(learntC);
 		removeClause(cand, cref);
 		sp->learntLBD = learntsize - 1;
-		newClause(learntC, cand.learnt());
+		const C_REF r = newClause(learntC, cand.learnt());
+		if (proof.lrat()) proof.bind(r);
 #ifdef STATISTICS
 		stats.vivify.strengthened++;
 #endif
@@ -444,6 +448,7 @@ void ParaFROST::vivifying(const CL_ST& type)
 	}
 	vhist.clear(true);
 	schedule.clear(true);
+	ignore = NOREF;
 	if (cnfstate) backtrack();
 	stats.vivify.vivified += vivified;
 	PFLOG2(2, " Vivification %lld: vivified %d %s clauses %.2f%% per %d candidates",
@@ -454,6 +459,7 @@ void ParaFROST::vivifying(const CL_ST& type)
 
 void ParaFROST::vivify()
 {
+	PERFPHASE(PERF_VIVIFY);
 	if (!cnfstate) return;
 	assert(probed);
 	assert(!DL());
@@ -71,6 +71,7 @@ inline void WALK::destroy()
 
 void ParaFROST::walk()
 {
+	PERFPHASE(PERF_WALK);
 	assert(!DL());
 	assert(UNSOLVED(cnfstate));
 	assert(sp->propagated == trail.size());
@@ -28,7 +28,7 @@ void ParaFROST::attachBins(BCNF& src, const bool& hasElim)
         forall_cnf(src, i) {
             const C_REF r = *i;
             if (cm.deleted(r)) continue;
-            assert(r < cm.size());
+            assert(cm.valid(r));
             CLAUSE& c = cm[r];
             if (c.binary()) {
                 if (MELTED(states[ABS(c[0])].state)
@@ -44,7 +44,7 @@ void ParaFROST::attachBins(BCNF& src, const bool& hasElim)
         forall_cnf(src, i) {
             const C_REF r = *i;
             if (cm.deleted(r)) continue;
-            assert(r < cm.size());
+            assert(cm.valid(r));
             const CLAUSE& c = cm[r];
             if (c.binary()) attachWatch(r, c);
         }
@@ -59,7 +59,7 @@ void ParaFROST::attachNonBins(BCNF& src, const bool& hasElim)
         forall_cnf(src, i) {
             const C_REF r = *i;
             if (cm.deleted(r)) continue;
-            assert(r < cm.size());
+            assert(cm.valid(r));
             CLAUSE& c = cm[r];
             if (c.binary()) continue;
             bool removed = false;
@@ -82,7 +82,7 @@ void ParaFROST::attachNonBins(BCNF& src, const bool& hasElim)
         forall_cnf(src, i) {
             const C_REF r = *i;
             if (cm.deleted(r)) continue;
-            assert(r < cm.size());
+            assert(cm.valid(r));
             CLAUSE& c = cm[r];
             if (c.binary()) continue;
             sortClause(c);
@@ -99,7 +99,7 @@ void ParaFROST::attachClauses(BCNF& src, const bool& hasElim)
         forall_cnf(src, i) {
             const C_REF r = *i;
             if (cm.deleted(r)) continue;
-            assert(r < cm.size());
+            assert(cm.valid(r));
             CLAUSE& c = cm[r];
             bool removed = false;
             forall_clause(c, k) {
@@ -121,7 +121,7 @@ void ParaFROST::attachClauses(BCNF& src, const bool& hasElim)
         forall_cnf(src, i) {
             const C_REF r = *i;
             if (cm.deleted(r)) continue;
-            assert(r < cm.size());
+            assert(cm.valid(r));
             CLAUSE& c = cm[r];
             if (!c.binary()) sortClause(c);
             attachWatch(r, c);
@@ -148,6 +148,7 @@ void ParaFROST::rebuildWT(const CL_ST& code)
         attachClauses(orgs);
         attachClauses(learnts);
     }
+    wt.compact();
 }
 
 void ParaFROST::sortWT()
@@ -25,15 +25,26 @@ along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 namespace pFROST {
 
+	// with 32-bit references (COMPACTREF), the binary flag is folded
+	// into the reference so that a watch takes 8 bytes; 64-bit references
+	// pad the watch to 16 bytes anyway, so the flag gets its own field
+	// and no mask is paid on reading or writing the reference
 	struct WATCH {
+#if defined(COMPACTREF)
+		C_REF	ref : sizeof(C_REF) * 8 - 1;
+		C_REF	bin : 1;
+		uint32	imp;
+#else
 		C_REF	ref;
+		uint32	bin;
 		uint32	imp;
-		int		size;
+#endif
 
-		inline		WATCH	() : ref(NOREF), imp(0), size(0) { }
+		inline		WATCH	() : ref(MAXREF), bin(0), imp(0) { }
 		inline		WATCH	(const C_REF& cref, const int& _size, const uint32& _imp) :
-			ref(cref), imp(_imp), size(_size) {}
-		inline bool binary	() const { return size == 2; }
+			ref(cref), bin(_size == 2), imp(_imp) { assert(cref <= MAXREF); }
+		inline bool binary	() const { return bin; }
+		inline void resize	(const int& _size) { bin = (_size == 2); }
 	};
 
 	struct DWATCH {
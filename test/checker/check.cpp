@@ -0,0 +1,70 @@
+/***********************************************************************[check.cpp]
+Copyright(c) 2020, Muhammad Osama - Anton Wijs,
+Technische Universiteit Eindhoven (TU/e).
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <https://www.gnu.org/licenses/>.
+**********************************************************************************/
+
+#include "checker.h"
+
+using namespace pFROST;
+
+/*****************************************************/
+/*  Usage: feeds a DIMACS formula and a textual DRAT */
+/*         proof to the online checker; exits with 0 */
+/*         if every lemma is implied, 1 otherwise    */
+/*  Dependency: PROOFCHECKER                         */
+/*****************************************************/
+
+static void feed(PROOFCHECKER& checker, const char* path, const bool& isproof)
+{
+	FILE* file = fopen(path, "r");
+	if (file == NULL) PFLOGE("cannot open \"%s\"", path);
+	uVec1D lits;
+	uint32 type = isproof ? CHECK_ADD : CHECK_ORIGINAL;
+	int ch;
+	while ((ch = getc(file)) != EOF) {
+		if (ch == 'c' || ch == 'p') {
+			while (ch != '\n' && ch != EOF) ch = getc(file);
+			continue;
+		}
+		if (ch == 'd') { type = CHECK_DELETE; continue; }
+		if (ch != '-' && (ch < '0' || ch > '9')) continue;
+		ungetc(ch, file);
+		int lit = 0;
+		if (fscanf(file, "%d", &lit) != 1) PFLOGE("unexpected character in \"%s\"", path);
+		if (lit) { lits.push(V2DEC(uint32(std::abs(lit)), lit < 0)); continue; }
+		checker.open(type, lits.size());
+		for (uint32 i = 0; i < lits.size(); i++) checker.put(lits[i]);
+		checker.commit();
+		lits.clear();
+		type = isproof ? CHECK_ADD : CHECK_ORIGINAL;
+	}
+	fclose(file);
+}
+
+int main(int argc, char** argv)
+{
+	if (argc != 3) PFLOGE("usage: %s <formula.cnf> <proof.drat>", argv[0]);
+	PROOFCHECKER checker;
+	checker.start();
+	feed(checker, argv[1], false);
+	feed(checker, argv[2], true);
+	checker.sync();
+	const bool failed = checker.error();
+	if (failed) printf("lemma %lld is not implied\n", checker.failedLemma());
+	else printf("%lld lemmas implied (%lld by RAT)%s\n", checker.lemmas(), checker.rats(), checker.verified() ? ", refuted" : "");
+	checker.stop();
+	return failed;
+}
@@ -0,0 +1,17 @@
+#!/bin/bash
+# builds the checker driver and runs each proof against its expected verdict
+dir=$(cd "$(dirname "$0")" && pwd)
+src=$dir/../../src/cpu
+bin=$(mktemp)
+trap 'rm -f $bin' EXIT
+g++ -std=c++11 -O2 -I$src $dir/check.cpp $src/checker.cpp -o $bin -lpthread || exit 1
+fail=0
+expect() {
+	$bin $dir/$2.cnf $dir/$2.drat > /dev/null
+	local status=$?
+	if [ $status != $1 ]; then echo "$2: expected exit $1, got $status"; fail=1; fi
+}
+expect 0 rat-blocked
+expect 1 rat-unit
+[ $fail = 0 ] && echo "checker tests passed"
+exit $fail
@@ -0,0 +1,50 @@
+#!/bin/bash
+# runs the installed solver on small formulas and compares each verdict
+dir=$(cd "$(dirname "$0")" && pwd)
+bin=${1:-$dir/../../build/cpu/parafrost}
+[ -x $bin ] || { echo "cannot find solver '$bin' (run install.sh -c)"; exit 1; }
+fail=0
+expect() {
+	local verdict=$1 formula=$2; shift 2
+	local out=$($bin $dir/$formula -quiet -modelverify "$@" 2>&1)
+	if ! echo "$out" | grep -q "^s $verdict"; then
+		echo "$formula $*: expected $verdict, got:"; echo "$out" | tail -3; fail=1
+	fi
+}
+expect SATISFIABLE sat.cnf
+expect UNSATISFIABLE php-3-2.cnf
+expect SATISFIABLE sat.cnf -parseincr
+expect UNSATISFIABLE php-3-2.cnf -parseincr
+# top-level units propagate only once the variables are added on demand
+expect SATISFIABLE unit-after-binary.cnf -parseincr
+# a NUL byte ends the input whatever the number of parser threads
+expect SATISFIABLE nul-tail.cnf
+expect SATISFIABLE nul-tail.cnf --parsethreads=4
+# each incremental call prints its own verdict, in order
+session() {
+	local formula=$1; shift
+	local out=$($bin $dir/$formula -quiet 2>&1 | grep "^s " | cut -d" " -f2 | tr "\n" " ")
+	if [ "$out" != "$* " ]; then
+		echo "$formula: expected $*, got $out"; fail=1
+	fi
+}
+session assume-unit.icnf UNSATISFIABLE
+session assume-learnt.icnf UNSATISFIABLE
+session units.icnf SATISFIABLE SATISFIABLE UNSATISFIABLE
+# stdin is sniffed for compressed data
+piped() {
+	local verdict=$1 formula=$2 tool=$3
+	command -v ${tool%% *} > /dev/null || return
+	local out=$($tool < $dir/$formula | $bin - -quiet 2>&1)
+	if ! echo "$out" | grep -q "^s $verdict"; then
+		echo "$tool $formula | -: expected $verdict, got:"; echo "$out" | tail -3; fail=1
+	fi
+}
+piped SATISFIABLE sat.cnf cat
+piped SATISFIABLE sat.cnf "gzip -c"
+piped SATISFIABLE sat.cnf "bzip2 -c"
+piped UNSATISFIABLE php-3-2.cnf "xz -c"
+piped UNSATISFIABLE php-3-2.cnf "zstd -q -c"
+piped SATISFIABLE nul-tail.cnf cat
+[ $fail = 0 ] && echo "solver tests passed"
+exit $fail